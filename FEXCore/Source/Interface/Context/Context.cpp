@@ -17,7 +17,6 @@
 namespace FEXCore::Context {
 void InitializeStaticTables(OperatingMode Mode) {
   X86Tables::InitializeInfoTables(Mode);
-  IR::InstallOpcodeHandlers(Mode);
 }
 
 fextl::unique_ptr<FEXCore::Context::Context> FEXCore::Context::Context::CreateNewContext(const FEXCore::HostFeatures& Features) {
@@ -225,7 +225,7 @@ void ContextImpl::ReconstructXMMRegisters(const FEXCore::Core::InternalThreadSta
   const size_t MaximumRegisters = Config.Is64BitMode ? FEXCore::Core::CPUState::NUM_XMMS : 8;
 
   if (YMM_High != nullptr && HostFeatures.SupportsAVX) {
-    const bool SupportsConvergedRegisters = HostFeatures.SupportsSVE256;
+    const bool SupportsConvergedRegisters = HostFeatures.SupportsAVX256;
 
     if (SupportsConvergedRegisters) {
       ///< Output wants to de-interleave
@@ -249,7 +249,7 @@ void ContextImpl::ReconstructXMMRegisters(const FEXCore::Core::InternalThreadSta
 void ContextImpl::SetXMMRegistersFromState(FEXCore::Core::InternalThreadState* Thread, const __uint128_t* XMM_Low, const __uint128_t* YMM_High) {
   const size_t MaximumRegisters = Config.Is64BitMode ? FEXCore::Core::CPUState::NUM_XMMS : 8;
   if (YMM_High != nullptr && HostFeatures.SupportsAVX) {
-    const bool SupportsConvergedRegisters = HostFeatures.SupportsSVE256;
+    const bool SupportsConvergedRegisters = HostFeatures.SupportsAVX256;
 
     if (SupportsConvergedRegisters) {
       ///< Output wants to de-interleave
@@ -394,7 +394,7 @@ void ContextImpl::InitializeCompiler(FEXCore::Core::InternalThreadState* Thread)
   Thread->OpDispatcher = fextl::make_unique<FEXCore::IR::OpDispatchBuilder>(this);
   Thread->OpDispatcher->SetMultiblock(Config.Multiblock);
   Thread->LookupCache = fextl::make_unique<FEXCore::LookupCache>(this);
-  Thread->FrontendDecoder = fextl::make_unique<FEXCore::Frontend::Decoder>(this);
+  Thread->FrontendDecoder = fextl::make_unique<FEXCore::Frontend::Decoder>(Thread);
   Thread->PassManager = fextl::make_unique<FEXCore::IR::PassManager>();
 
   Thread->CurrentFrame->Pointers.Common.L1Pointer = Thread->LookupCache->GetL1Pointer();
@@ -772,6 +772,11 @@ ContextImpl::CompileCodeResult ContextImpl::CompileCode(FEXCore::Core::InternalT
   // AOT IR bookkeeping and cache
   {
     auto IRFromAOT = IRCaptureCache.PreGenerateIRFetch(Thread, GuestRIP);
+    if (IRFromAOT && IRFromAOT->CopiedToCapture) {
+      // AOT generation reused the cached entry as is, same as the early exit in PostCompileCode.
+      return {};
+    }
+
     if (IRFromAOT) {
       // Setup pointers to internal structures
       IR = std::move(IRFromAOT->IR);
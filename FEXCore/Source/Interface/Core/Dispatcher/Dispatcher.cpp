@@ -454,11 +454,21 @@ void Dispatcher::EmitDispatcher() {
     // Store RIP to the context state
     str(ARMEmitter::XReg::x1, STATE_PTR(CpuStateFrame, State.rip));
 
+    // Callbacks are usually invoked repeatedly with the same target, so probe the L1 cache directly
+    // while RIP is still in a register.
+    ldr(TMP1, STATE_PTR(CpuStateFrame, Pointers.Common.L1Pointer));
+    and_(ARMEmitter::Size::i64Bit, TMP4, ARMEmitter::Reg::r1, LookupCache::L1_ENTRIES_MASK);
+    add(ARMEmitter::Size::i64Bit, TMP1, TMP1, TMP4, ARMEmitter::ShiftType::LSL, 4);
+    ldp<ARMEmitter::IndexType::OFFSET>(TMP3, TMP4, TMP1, 0);
+    sub(ARMEmitter::Size::i64Bit, TMP1, TMP4, ARMEmitter::XReg::x1);
+
     // load static regs
     FillStaticRegs();
 
-    // Now go back to the regular dispatcher loop
-    b(&LoopTop);
+    // On a miss go back to the regular dispatcher loop for a full lookup, otherwise jump straight to the block.
+    // TMP1 and TMP3 are preserved by FillStaticRegs.
+    cbnz(ARMEmitter::Size::i64Bit, TMP1, &LoopTop);
+    br(TMP3);
   }
 
   auto EmitLongALUOpHandler = [&](auto R, auto Offset) {
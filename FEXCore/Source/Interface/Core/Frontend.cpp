@@ -14,7 +14,9 @@ $end_info$
 #include <algorithm>
 #include <cstring>
 #include <FEXCore/Config/Config.h>
+#include <FEXCore/Core/Thunks.h>
 #include <FEXCore/Core/X86Enums.h>
+#include <FEXCore/Debug/InternalThreadState.h>
 #include <FEXCore/HLE/SyscallHandler.h>
 #include <FEXCore/Utils/Allocator.h>
 #include <FEXCore/Utils/LogManager.h>
@@ -64,10 +66,11 @@ static uint32_t MapVEXToReg(uint8_t vvvv, bool HasXMM) {
   }
 }
 
-Decoder::Decoder(FEXCore::Context::ContextImpl* ctx)
-  : CTX {ctx}
-  , OSABI {ctx->SyscallHandler ? ctx->SyscallHandler->GetOSABI() : FEXCore::HLE::SyscallOSABI::OS_UNKNOWN}
-  , PoolObject {ctx->FrontendAllocator, sizeof(FEXCore::X86Tables::DecodedInst) * DefaultDecodedBufferSize} {}
+Decoder::Decoder(FEXCore::Core::InternalThreadState* Thread)
+  : Thread {Thread}
+  , CTX {static_cast<FEXCore::Context::ContextImpl*>(Thread->CTX)}
+  , OSABI {CTX->SyscallHandler ? CTX->SyscallHandler->GetOSABI() : FEXCore::HLE::SyscallOSABI::OS_UNKNOWN}
+  , PoolObject {CTX->FrontendAllocator, sizeof(FEXCore::X86Tables::DecodedInst) * DefaultDecodedBufferSize} {}
 
 Decoder::~Decoder() {
   PoolObject.UnclaimBuffer();
@@ -1012,11 +1015,40 @@ bool Decoder::BranchTargetCanContinue(bool FinalInstruction) const {
       // Optimization occurs inside of the OpDispatcher implementation
       return true;
     }
+
+    if (IsInlineableThunkStub(TargetRIP)) {
+      // Calls to thunk stubs are executed inline by the OpDispatcher, which
+      // saves leaving the block for the stub and again for its return.
+      DecodeInst->Flags |= DecodeFlags::FLAG_INLINE_THUNK_CALL;
+      return true;
+    }
   }
 
   return false;
 }
 
+bool Decoder::IsInlineableThunkStub(uint64_t TargetRIP) const {
+  // Full SMC checks only validate the bytes of decoded instructions, which wouldn't cover the stub
+  if (!CTX->ThunkHandler || !CTX->SyscallHandler || CTX->Config.SMCChecks == FEXCore::Config::CONFIG_SMC_FULL) {
+    return false;
+  }
+
+  // The call target hasn't been decoded yet and may not even be mapped, so check before reading it
+  if (!CTX->SyscallHandler->IsGuestExecutableRange(Thread, TargetRIP, ThunkStubSize)) {
+    return false;
+  }
+
+  // Thunk stubs consist of the OP_THUNK instruction followed by the SHA256 of the thunk name
+  const auto Stub = reinterpret_cast<const uint8_t*>(TargetRIP);
+  if (Stub[0] != 0x0F || Stub[1] != 0x3F) {
+    return false;
+  }
+
+  // Thunks of host libraries that haven't been loaded yet must go through the stub.
+  // The lookup result doesn't change afterwards, since host libraries are never unloaded.
+  return CTX->ThunkHandler->LookupThunk(*reinterpret_cast<const FEXCore::IR::SHA256Sum*>(Stub + 2)) != nullptr;
+}
+
 const uint8_t* Decoder::AdjustAddrForSpecialRegion(const uint8_t* _InstStream, uint64_t EntryPoint, uint64_t RIP) {
   constexpr uint64_t VSyscall_Base = 0xFFFF'FFFF'FF60'0000ULL;
   constexpr uint64_t VSyscall_End = VSyscall_Base + 0x1000;
@@ -1167,6 +1199,17 @@ void Decoder::DecodeInstructionsAtEntry(const uint8_t* _InstStream, uint64_t PC,
 
         // Bypass branches if we can continue through them in some cases.
         CanContinue |= BranchTargetCanContinue(FinalInstruction);
+
+        if (DecodeInst->Flags & DecodeFlags::FLAG_INLINE_THUNK_CALL) {
+          // The inlined stub is part of this block now, so writes to it must invalidate the block too
+          uint64_t StubRIP = DecodeInst->PC + DecodeInst->InstSize + DecodeInst->Src[0].Literal();
+          if (CTX->GetGPRSize() == 4) {
+            StubRIP &= 0xFFFFFFFFU;
+          }
+
+          CodePages.insert(StubRIP & FEXCore::Utils::FEX_PAGE_MASK);
+          CodePages.insert((StubRIP + ThunkStubSize - 1) & FEXCore::Utils::FEX_PAGE_MASK);
+        }
       }
 
       if (FinalInstruction || !CanContinue) {
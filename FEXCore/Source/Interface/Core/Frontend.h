@@ -32,7 +32,7 @@ public:
     fextl::vector<DecodedBlocks> Blocks;
   };
 
-  Decoder(FEXCore::Context::ContextImpl* ctx);
+  Decoder(FEXCore::Core::InternalThreadState* Thread);
   ~Decoder();
   void DecodeInstructionsAtEntry(const uint8_t* InstStream, uint64_t PC, uint64_t MaxInst,
                                  std::function<void(uint64_t BlockEntry, uint64_t Start, uint64_t Length)> AddContainedCodePage);
@@ -51,6 +51,13 @@ public:
     ExternalBranches = v;
   }
 
+  uint64_t GetSectionMaxAddress() const {
+    return SectionMaxAddress;
+  }
+  fextl::set<uint64_t>* GetExternalBranches() const {
+    return ExternalBranches;
+  }
+
   void DelayedDisownBuffer() {
     PoolObject.DelayedDisownBuffer();
   }
@@ -64,6 +71,7 @@ private:
     bool L;       // VEX.L bit (if set then 256 bit operation, if unset then scalar or 128-bit operation)
   };
 
+  FEXCore::Core::InternalThreadState* Thread;
   FEXCore::Context::ContextImpl* CTX;
   const FEXCore::HLE::SyscallOSABI OSABI {};
 
@@ -71,6 +79,7 @@ private:
 
   void BranchTargetInMultiblockRange();
   bool BranchTargetCanContinue(bool FinalInstruction) const;
+  bool IsInlineableThunkStub(uint64_t TargetRIP) const;
 
   uint8_t ReadByte();
   uint8_t PeekByte(uint8_t Offset) const;
@@ -90,6 +99,8 @@ private:
   const uint8_t* InstStream;
 
   static constexpr size_t MAX_INST_SIZE = 15;
+  // OP_THUNK followed by the SHA256 of the thunk name
+  static constexpr size_t ThunkStubSize = 2 + 32;
   uint8_t InstructionSize;
   std::array<uint8_t, MAX_INST_SIZE> Instruction;
   FEXCore::X86Tables::DecodedInst* DecodeInst;
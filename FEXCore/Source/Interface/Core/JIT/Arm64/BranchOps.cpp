@@ -150,6 +150,46 @@ DEF_OP(Syscall) {
   // X2: Pointer to SyscallArguments
 
   FEXCore::IR::SyscallFlags Flags = Op->Flags;
+
+  // If the syscall number wasn't constant, look it up in the handler's table of passthrough syscalls at runtime.
+  // This catches syscalls where the number is set up in a different block, like the 32-bit vsyscall entry.
+  const auto InlineSyscalls = CTX->SyscallHandler->GetInlineSyscallTable();
+  bool TryInline = !InlineSyscalls.empty() && Flags == FEXCore::IR::SyscallFlags::DEFAULT;
+  ARMEmitter::ForwardLabel HandlerPath;
+  ARMEmitter::ForwardLabel Done;
+
+  if (TryInline) {
+    const auto SyscallNumberOp = IR->GetOp<IR::IROp_Header>(Op->Header.Args[0]);
+    if (SyscallNumberOp->Op == IR::OP_CONSTANT) {
+      // A constant number can be looked up now. Most passthrough syscalls were already turned in to InlineSyscall by
+      // ConstProp, so this usually leaves only the handler call.
+      const uint64_t SyscallNumber = SyscallNumberOp->C<IR::IROp_Constant>()->Constant;
+      const int32_t HostSyscallNumber = SyscallNumber < InlineSyscalls.size() ? InlineSyscalls[SyscallNumber] : -1;
+      if (HostSyscallNumber != -1) {
+        EmitInlineSyscall(Node, &Op->Header.Args[1], Flags, HostSyscallNumber);
+        return;
+      }
+      TryInline = false;
+    }
+  }
+
+  if (TryInline) {
+    // NZCV hasn't been spilled yet, so the bounds check can't use flags. The table size is a power of two.
+    const auto SyscallNumber = GetReg(Op->Header.Args[0].ID());
+    lsr(ARMEmitter::Size::i64Bit, TMP1, SyscallNumber, FEXCore::ilog2(InlineSyscalls.size()));
+    cbnz(ARMEmitter::Size::i64Bit, TMP1, &HandlerPath);
+
+    // Table entries are -1 for syscalls that need the handler
+    ldr(TMP1, STATE, offsetof(FEXCore::Core::CpuStateFrame, Pointers.Common.InlineSyscallTable));
+    ldr(TMP3.W(), TMP1, SyscallNumber, ARMEmitter::ExtendedType::LSL_64, 2);
+    tbnz(TMP3, 31, &HandlerPath);
+
+    EmitInlineSyscall(Node, &Op->Header.Args[1], Flags, -1, TMP3.R());
+    b(&Done);
+
+    Bind(&HandlerPath);
+  }
+
   PushDynamicRegsAndLR(TMP1);
 
   uint32_t GPRSpillMask = ~0U;
@@ -209,10 +249,14 @@ DEF_OP(Syscall) {
       mov(ARMEmitter::Size::i64Bit, GetReg(Node), ARMEmitter::Reg::r0);
     }
   }
+
+  if (TryInline) {
+    Bind(&Done);
+  }
 }
 
-DEF_OP(InlineSyscall) {
-  auto Op = IROp->C<IR::IROp_InlineSyscall>();
+void Arm64JITCore::EmitInlineSyscall(IR::NodeID Node, const IR::OrderedNodeWrapper* Args, FEXCore::IR::SyscallFlags Flags,
+                                     int32_t HostSyscallNumber, std::optional<ARMEmitter::Register> HostSyscallNumberReg) {
   // Arguments are passed as follows:
   // X8: SyscallNumber - RA INTERSECT
   // X0: Arg0 & Return
@@ -231,11 +275,11 @@ DEF_OP(InlineSyscall) {
   // We always need to spill x8 since we can't know if it is live at this SSA location
   uint32_t SpillMask = 1U << 8;
   for (uint32_t i = 0; i < FEXCore::HLE::SyscallArguments::MAX_ARGS - 1; ++i) {
-    if (Op->Header.Args[i].IsInvalid()) {
+    if (Args[i].IsInvalid()) {
       break;
     }
 
-    auto Reg = GetReg(Op->Header.Args[i].ID());
+    auto Reg = GetReg(Args[i].ID());
     if (Reg == ARMEmitter::Reg::r8 || Reg == ARMEmitter::Reg::r4 || Reg == ARMEmitter::Reg::r5) {
 
       SpillMask |= (1U << Reg.Idx());
@@ -253,6 +297,12 @@ DEF_OP(InlineSyscall) {
   // 16bit LoadConstant to be a single instruction
   // We must always spill at least one register (x8) so this value always has a bit set
   // This gives the signal handler a value to check to see if we are in a syscall at all
+  if (HostSyscallNumberReg) {
+    LOGMAN_THROW_A_FMT(*HostSyscallNumberReg != TMP1.R(), "Syscall number would be clobbered by the spill");
+    // x8 has been spilled, move the syscall number out of the way of the arguments
+    mov(ARMEmitter::Size::i32Bit, ARMEmitter::Reg::r8, *HostSyscallNumberReg);
+  }
+
   LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r0, SpillMask & 0xFFFF);
   str(ARMEmitter::XReg::x0, STATE, offsetof(FEXCore::Core::CpuStateFrame, InSyscallInfo));
 
@@ -261,11 +311,11 @@ DEF_OP(InlineSyscall) {
   const auto EmitSubSize = CTX->Config.Is64BitMode() ? ARMEmitter::SubRegSize::i64Bit : ARMEmitter::SubRegSize::i32Bit;
   if (Intersects) {
     for (uint32_t i = 0; i < FEXCore::HLE::SyscallArguments::MAX_ARGS - 1; ++i) {
-      if (Op->Header.Args[i].IsInvalid()) {
+      if (Args[i].IsInvalid()) {
         break;
       }
 
-      auto Reg = GetReg(Op->Header.Args[i].ID());
+      auto Reg = GetReg(Args[i].ID());
       if (SpillMask & (1U << Reg.Idx())) {
         // In the case of intersection with x4, x5, or x8 then these are currently SRA
         // for registers RAX, RDX, and RSP. Which have just been spilled
@@ -279,19 +329,21 @@ DEF_OP(InlineSyscall) {
     }
   } else {
     for (uint32_t i = 0; i < FEXCore::HLE::SyscallArguments::MAX_ARGS - 1; ++i) {
-      if (Op->Header.Args[i].IsInvalid()) {
+      if (Args[i].IsInvalid()) {
         break;
       }
 
-      mov(EmitSize, RegArgs[i].R(), GetReg(Op->Header.Args[i].ID()));
+      mov(EmitSize, RegArgs[i].R(), GetReg(Args[i].ID()));
     }
   }
 
-  LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r8, Op->HostSyscallNumber);
+  if (!HostSyscallNumberReg) {
+    LoadConstant(ARMEmitter::Size::i64Bit, ARMEmitter::Reg::r8, HostSyscallNumber);
+  }
   svc(0);
   // On updated signal mask we can receive a signal RIGHT HERE
 
-  if ((Op->Flags & FEXCore::IR::SyscallFlags::NORETURN) != FEXCore::IR::SyscallFlags::NORETURN) {
+  if ((Flags & FEXCore::IR::SyscallFlags::NORETURN) != FEXCore::IR::SyscallFlags::NORETURN) {
     // Now that we are done in the syscall we need to carefully peel back the state
     // First unspill the registers from before
     FillStaticRegs(false, SpillMask, ~0U, ARMEmitter::Reg::r8, ARMEmitter::Reg::r1);
@@ -306,6 +358,11 @@ DEF_OP(InlineSyscall) {
   }
 }
 
+DEF_OP(InlineSyscall) {
+  auto Op = IROp->C<IR::IROp_InlineSyscall>();
+  EmitInlineSyscall(Node, Op->Header.Args, Op->Flags, Op->HostSyscallNumber);
+}
+
 DEF_OP(Thunk) {
   auto Op = IROp->C<IR::IROp_Thunk>();
   // Arguments are passed as follows:
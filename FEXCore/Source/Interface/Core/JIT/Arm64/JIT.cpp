@@ -21,6 +21,7 @@ $end_info$
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 
 #include "Utils/MemberFunctionToPointer.h"
+#include "Utils/SpinWaitLock.h"
 
 #include <FEXCore/Core/X86Enums.h>
 #include <FEXCore/Debug/InternalThreadState.h>
@@ -32,6 +33,7 @@ $end_info$
 
 #include "Interface/Core/Interpreter/InterpreterOps.h"
 
+#include <algorithm>
 #include <stdio.h>
 #include <unistd.h>
 #include <string.h>
@@ -523,11 +525,19 @@ Arm64JITCore::Arm64JITCore(FEXCore::Context::ContextImpl* ctx, FEXCore::Core::In
   , Arm64Emitter(ctx)
   , HostSupportsSVE128 {ctx->HostFeatures.SupportsSVE128}
   , HostSupportsSVE256 {ctx->HostFeatures.SupportsSVE256}
-  , HostSupportsAVX256 {ctx->HostFeatures.SupportsAVX && ctx->HostFeatures.SupportsSVE256}
+  , HostSupportsAVX256 {ctx->HostFeatures.SupportsAVX256}
   , HostSupportsRPRES {ctx->HostFeatures.SupportsRPRES}
   , HostSupportsAFP {ctx->HostFeatures.SupportsAFP}
+  , HostSupportsWFXT {ctx->HostFeatures.SupportsWFXT}
   , CTX {ctx} {
 
+#ifdef _M_ARM_64
+  if (HostSupportsWFXT) {
+    // PAUSE stalls for around 40ns on recent x86 cores. Guest spin loops are tuned for that, so wait for about as long.
+    PauseCycles = std::max<uint32_t>(1, FEXCore::Utils::SpinWaitLock::CycleCounterFrequency / 25'000'000);
+  }
+#endif
+
   RAPass = Thread->PassManager->GetPass<IR::RegisterAllocationPass>("RA");
 
   RAPass->AddRegisters(FEXCore::IR::GPRClass, GeneralRegisters.size());
@@ -561,6 +571,7 @@ Arm64JITCore::Arm64JITCore(FEXCore::Context::ContextImpl* ctx, FEXCore::Core::In
       FEXCore::Utils::MemberFunctionToPointerCast PMF(&FEXCore::HLE::SyscallHandler::HandleSyscall);
       Common.SyscallHandlerObj = reinterpret_cast<uint64_t>(CTX->SyscallHandler);
       Common.SyscallHandlerFunc = PMF.GetVTableEntry(CTX->SyscallHandler);
+      Common.InlineSyscallTable = reinterpret_cast<uint64_t>(CTX->SyscallHandler->GetInlineSyscallTable().data());
     }
     Common.ExitFunctionLink = reinterpret_cast<uintptr_t>(&Context::ContextImpl::ThreadExitFunctionLink<Arm64JITCore_ExitFunctionLink>);
 
@@ -24,6 +24,7 @@ $end_info$
 
 #include <array>
 #include <cstdint>
+#include <optional>
 #include <utility>
 #include <variant>
 
@@ -55,6 +56,9 @@ private:
   const bool HostSupportsAVX256 {};
   const bool HostSupportsRPRES {};
   const bool HostSupportsAFP {};
+  const bool HostSupportsWFXT {};
+  // Number of cycle counter ticks a guest PAUSE waits for, when WFET is supported.
+  uint32_t PauseCycles {};
 
   ARMEmitter::BiDirectionalLabel* PendingTargetLabel;
   FEXCore::Context::ContextImpl* CTX;
@@ -255,6 +259,12 @@ private:
   FEXCore::Core::DebugData* DebugData;
 
   void ResetStack();
+
+  // Passes a syscall through to the host. The host syscall number is either the constant HostSyscallNumber or
+  // held in HostSyscallNumberReg. The register is copied to x8 after spilling and before the arguments are set up,
+  // so it may be one of the argument registers. It must not be TMP1, which the spill clobbers.
+  void EmitInlineSyscall(IR::NodeID Node, const IR::OrderedNodeWrapper* Args, FEXCore::IR::SyscallFlags Flags, int32_t HostSyscallNumber,
+                         std::optional<ARMEmitter::Register> HostSyscallNumberReg = std::nullopt);
   /**
    * @name Relocations
    * @{ */
@@ -262,7 +262,16 @@ DEF_OP(RDRAND) {
 }
 
 DEF_OP(Yield) {
-  yield();
+  // YIELD is a NOP on most cores, which lets guest spin loops hammer the contended cacheline far harder than on x86.
+  if (HostSupportsWFXT) {
+    // Wait for a fixed amount of time in a low power state, like PAUSE does.
+    mrs(TMP1, ARMEmitter::SystemRegister::CNTVCT_EL0);
+    add(ARMEmitter::Size::i64Bit, TMP1, TMP1, PauseCycles);
+    wfet(TMP1);
+  } else {
+    // ISB at least stalls the pipeline for a short while.
+    isb();
+  }
 }
 
 #undef DEF_OP
@@ -432,6 +432,7 @@ public:
   void MOVSSOp(OpcodeArgs);
   void VectorALUOp(OpcodeArgs, IROps IROp, size_t ElementSize);
   void VectorXOROp(OpcodeArgs);
+  Ref VectorALUSameSourceIdiom(IROps IROp, uint8_t Size);
 
   void VectorALUROp(OpcodeArgs, IROps IROp, size_t ElementSize);
   void VectorUnaryOp(OpcodeArgs, IROps IROp, size_t ElementSize);
@@ -1345,6 +1346,9 @@ private:
   // Used during new op bringup
   bool ShouldDump {false};
 
+  // Calls the host function of the thunk stub at StubPC
+  void CallThunkStub(uint64_t StubPC);
+
   using SaveStoreAVXStatePtr = void (OpDispatchBuilder::*)(Ref MemBase);
   using DefaultAVXStatePtr = void (OpDispatchBuilder::*)();
   SaveStoreAVXStatePtr SaveAVXStateFunc {&OpDispatchBuilder::SaveAVXState};
@@ -1543,7 +1547,7 @@ private:
   }
 
   constexpr OpSize GetGuestVectorLength() const {
-    return (CTX->HostFeatures.SupportsSVE256 && CTX->HostFeatures.SupportsAVX) ? OpSize::i256Bit : OpSize::i128Bit;
+    return CTX->HostFeatures.SupportsAVX256 ? OpSize::i256Bit : OpSize::i128Bit;
   }
 
   [[nodiscard]]
@@ -1959,6 +1963,14 @@ private:
 
     uint64_t Bit = (1ull << (uint64_t)Index);
 
+    // Storing back the unmodified value that was loaded from the context is a
+    // no-op, don't mark it as written. AVX128 upper halves stay cached until
+    // the block exit, and instructions that pass them through would otherwise
+    // cost a context store at every exit.
+    if ((RegCache.Cached & ~RegCache.Written & ~RegCache.Partial & Bit) && RegCache.Value[Index] == Value) {
+      return;
+    }
+
     RegCache.Value[Index] = Value;
     RegCache.Cached |= Bit;
     RegCache.Written |= Bit;
@@ -2503,6 +2515,27 @@ constexpr inline void InstallToTable(auto& FinalTable, const auto& LocalTable) {
   }
 }
 
-void InstallOpcodeHandlers(Context::OperatingMode Mode);
+// X87 dispatch tables use the top bit of the opcode to indicate the handler is repeated with {0x40, 0x80} or'd in.
+constexpr inline void InstallToX87Table(auto& FinalTable, const auto& LocalTable) {
+  for (const auto& Op : LocalTable) {
+    auto OpNum = std::get<0>(Op);
+    bool Repeat = (OpNum & 0x8000) != 0;
+    OpNum = OpNum & 0x7FF;
+    auto Dispatcher = std::get<2>(Op);
+    for (uint8_t i = 0; i < std::get<1>(Op); ++i) {
+#if defined(ASSERTIONS_ENABLED) && ASSERTIONS_ENABLED
+      if (FinalTable[OpNum + i].OpcodeDispatcher) {
+        ERROR_AND_DIE_FMT("Duplicate Entry {}", FinalTable[OpNum + i].Name);
+      }
+#endif
+      FinalTable[OpNum + i].OpcodeDispatcher = Dispatcher;
+
+      if (Repeat) {
+        FinalTable[(OpNum | 0x40) + i].OpcodeDispatcher = Dispatcher;
+        FinalTable[(OpNum | 0x80) + i].OpcodeDispatcher = Dispatcher;
+      }
+    }
+  }
+}
 
 } // namespace FEXCore::IR
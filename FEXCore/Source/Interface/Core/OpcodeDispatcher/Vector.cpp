@@ -243,8 +243,28 @@ void OpDispatchBuilder::VMOVSSOp(OpcodeArgs) {
   VMOVScalarOpImpl(Op, 4);
 }
 
+Ref OpDispatchBuilder::VectorALUSameSourceIdiom(IROps IROp, uint8_t Size) {
+  // Integer subtract or compare of a register with itself is how x86 code materializes all-zeroes or all-ones
+  // without a dependency on the source. Returns nullptr if the operation doesn't have a constant result.
+  switch (IROp) {
+  case OP_VSUB:
+  case OP_VUQSUB:
+  case OP_VSQSUB: return LoadZeroVector(Size);
+  case OP_VCMPEQ: return _VectorImm(Size, 1, 0xFF);
+  default: return nullptr;
+  }
+}
+
 void OpDispatchBuilder::VectorALUOp(OpcodeArgs, IROps IROp, size_t ElementSize) {
   const auto Size = GetSrcSize(Op);
+
+  if (Op->Dest.IsGPR() && Op->Src[0].IsGPR() && Op->Dest.Data.GPR.GPR == Op->Src[0].Data.GPR.GPR) {
+    if (Ref Result = VectorALUSameSourceIdiom(IROp, Size)) {
+      StoreResult(FPRClass, Op, Result, -1);
+      return;
+    }
+  }
+
   Ref Src = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags);
   Ref Dest = LoadSource(FPRClass, Op, Op->Dest, Op->Flags);
 
@@ -270,6 +290,13 @@ void OpDispatchBuilder::VectorXOROp(OpcodeArgs) {
 void OpDispatchBuilder::AVXVectorALUOp(OpcodeArgs, IROps IROp, size_t ElementSize) {
   const auto Size = GetSrcSize(Op);
 
+  if (Op->Src[0].IsGPR() && Op->Src[1].IsGPR() && Op->Src[0].Data.GPR.GPR == Op->Src[1].Data.GPR.GPR) {
+    if (Ref Result = VectorALUSameSourceIdiom(IROp, GetDstSize(Op))) {
+      StoreResult(FPRClass, Op, Result, -1);
+      return;
+    }
+  }
+
   Ref Src1 = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags);
   Ref Src2 = LoadSource(FPRClass, Op, Op->Src[1], Op->Flags);
 
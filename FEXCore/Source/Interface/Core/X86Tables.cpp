@@ -8,21 +8,37 @@ $end_info$
 
 #include "Interface/Core/X86Tables/X86Tables.h"
 
+#include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/Context.h>
 
 namespace FEXCore::X86Tables {
 
-void InitializeBaseTables(Context::OperatingMode Mode);
-void InitializeSecondaryTables(Context::OperatingMode Mode);
 void InitializeSecondaryGroupTables(Context::OperatingMode Mode);
-void InitializePrimaryGroupTables(Context::OperatingMode Mode);
 void InitializeH0F3ATables(Context::OperatingMode Mode);
 
 void InitializeInfoTables(Context::OperatingMode Mode) {
-  InitializeBaseTables(Mode);
-  InitializeSecondaryTables(Mode);
+  // Every variant of these was generated at compile time, only pick the ones this process uses.
+  if (Mode == Context::MODE_64BIT) {
+    BaseOps = BaseOps_64.data();
+    SecondBaseOps = SecondBaseOps_64.data();
+    RepModOps = RepModOps_64.data();
+    RepNEModOps = RepNEModOps_64.data();
+    OpSizeModOps = OpSizeModOps_64.data();
+    PrimaryInstGroupOps = PrimaryInstGroupOps_64.data();
+  } else {
+    BaseOps = BaseOps_32.data();
+    SecondBaseOps = SecondBaseOps_32.data();
+    RepModOps = RepModOps_32.data();
+    RepNEModOps = RepNEModOps_32.data();
+    OpSizeModOps = OpSizeModOps_32.data();
+    PrimaryInstGroupOps = PrimaryInstGroupOps_32.data();
+  }
+
+  FEX_CONFIG_OPT(ReducedPrecision, X87REDUCEDPRECISION);
+  X87Ops = ReducedPrecision ? X87Ops_F64.data() : X87Ops_F80.data();
+
+  // These also get host specific handlers installed later, so they are still patched in place.
   InitializeSecondaryGroupTables(Mode);
-  InitializePrimaryGroupTables(Mode);
   InitializeH0F3ATables(Mode);
 }
 
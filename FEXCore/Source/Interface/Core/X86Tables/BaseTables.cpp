@@ -15,7 +15,8 @@ $end_info$
 namespace FEXCore::X86Tables {
 using namespace InstFlags;
 
-std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps = []() consteval {
+namespace {
+constexpr auto BaseOpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> Table{};
 
   constexpr U8U8InfoStruct BaseOpTable[] = {
@@ -240,10 +241,12 @@ std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps = []() consteval {
   IR::InstallToTable(Table, IR::OpDispatch_BaseOpTable);
 
   return Table;
-}();
+};
 
-void InitializeBaseTables(Context::OperatingMode Mode) {
-  static constexpr U8U8InfoStruct BaseOpTable_64[] = {
+constexpr auto BaseOpsModeLambda = [](Context::OperatingMode Mode) constexpr {
+  auto Table = BaseOpsLambda();
+
+  constexpr U8U8InfoStruct BaseOpTable_64[] = {
     {0x06, 2, X86InstInfo{"[INV]",  TYPE_INVALID, FLAGS_NONE,                                                                     0, nullptr}},
     {0x0E, 1, X86InstInfo{"[INV]",  TYPE_INVALID, FLAGS_NONE,                                                                     0, nullptr}},
     {0x16, 2, X86InstInfo{"[INV]",  TYPE_INVALID, FLAGS_NONE,                                                                     0, nullptr}},
@@ -270,7 +273,7 @@ void InitializeBaseTables(Context::OperatingMode Mode) {
     {0xEA, 1, X86InstInfo{"[INV]",  TYPE_INVALID, FLAGS_NONE,                                                                                                      0, nullptr}},
   };
 
-  static constexpr U8U8InfoStruct BaseOpTable_32[] = {
+  constexpr U8U8InfoStruct BaseOpTable_32[] = {
     {0x06, 1, X86InstInfo{"PUSH ES",  TYPE_INST, GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS,            0, nullptr}},
     {0x07, 1, X86InstInfo{"POP ES",   TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_DEF) | FLAGS_DEBUG_MEM_ACCESS,    0, nullptr}},
     {0x0E, 1, X86InstInfo{"PUSH CS",  TYPE_INST, GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS,            0, nullptr}},
@@ -302,13 +305,20 @@ void InitializeBaseTables(Context::OperatingMode Mode) {
   };
 
   if (Mode == Context::MODE_64BIT) {
-    GenerateTable(&BaseOps.at(0), BaseOpTable_64, std::size(BaseOpTable_64));
-    IR::InstallToTable(BaseOps, IR::OpDispatch_BaseOpTable_64);
+    GenerateTable(&Table.at(0), BaseOpTable_64, std::size(BaseOpTable_64));
+    IR::InstallToTable(Table, IR::OpDispatch_BaseOpTable_64);
   }
   else {
-    GenerateTable(&BaseOps.at(0), BaseOpTable_32, std::size(BaseOpTable_32));
-    IR::InstallToTable(BaseOps, IR::OpDispatch_BaseOpTable_32);
+    GenerateTable(&Table.at(0), BaseOpTable_32, std::size(BaseOpTable_32));
+    IR::InstallToTable(Table, IR::OpDispatch_BaseOpTable_32);
   }
-}
+
+  return Table;
+};
+} // anonymous namespace
+
+constexpr std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps_64 = BaseOpsModeLambda(Context::MODE_64BIT);
+constexpr std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps_32 = BaseOpsModeLambda(Context::MODE_32BIT);
+const X86InstInfo* BaseOps = BaseOps_64.data();
 }
 
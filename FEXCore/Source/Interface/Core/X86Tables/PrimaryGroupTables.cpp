@@ -14,7 +14,8 @@ $end_info$
 
 namespace FEXCore::X86Tables {
 using namespace InstFlags;
-std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps = []() consteval {
+namespace {
+constexpr auto PrimaryInstGroupOpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> Table{};
 #define OPD(group, prefix, Reg) (((group - FEXCore::X86Tables::TYPE_GROUP_1) << 6) | (prefix) << 3 | (Reg))
   constexpr U16U8InfoStruct PrimaryGroupOpTable[] = {
@@ -148,15 +149,17 @@ std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps = []() co
 
   IR::InstallToTable(Table, IR::OpDispatch_PrimaryGroupTables);
   return Table;
-}();
+};
 
-void InitializePrimaryGroupTables(Context::OperatingMode Mode) {
-  const U16U8InfoStruct PrimaryGroupOpTable_64[] = {
+constexpr auto PrimaryInstGroupOpsModeLambda = [](Context::OperatingMode Mode) constexpr {
+  auto Table = PrimaryInstGroupOpsLambda();
+
+  constexpr U16U8InfoStruct PrimaryGroupOpTable_64[] = {
     // Invalid in 64bit mode
     {OPD(TYPE_GROUP_1, OpToIndex(0x82), 0), 8, X86InstInfo{"",     TYPE_INVALID, FLAGS_NONE,                                                        0, nullptr}},
   };
 
-  const U16U8InfoStruct PrimaryGroupOpTable_32[] = {
+  constexpr U16U8InfoStruct PrimaryGroupOpTable_32[] = {
     // Duplicates the 0x80 opcode group
     {OPD(TYPE_GROUP_1, OpToIndex(0x82), 0), 1, X86InstInfo{"ADD",  TYPE_INST, GenFlagsSameSize(SIZE_8BIT) | FLAGS_MODRM | FLAGS_SF_MOD_DST,                                      1, nullptr}},
     {OPD(TYPE_GROUP_1, OpToIndex(0x82), 1), 1, X86InstInfo{"OR",   TYPE_INST, GenFlagsSameSize(SIZE_8BIT) | FLAGS_MODRM | FLAGS_SF_MOD_DST,                                      1, nullptr}},
@@ -171,11 +174,18 @@ void InitializePrimaryGroupTables(Context::OperatingMode Mode) {
 #undef OPD
 
   if (Mode == Context::MODE_64BIT) {
-    GenerateTable(&PrimaryInstGroupOps.at(0), PrimaryGroupOpTable_64, std::size(PrimaryGroupOpTable_64));
+    GenerateTable(&Table.at(0), PrimaryGroupOpTable_64, std::size(PrimaryGroupOpTable_64));
   }
   else {
-    GenerateTable(&PrimaryInstGroupOps.at(0), PrimaryGroupOpTable_32, std::size(PrimaryGroupOpTable_32));
+    GenerateTable(&Table.at(0), PrimaryGroupOpTable_32, std::size(PrimaryGroupOpTable_32));
   }
-}
+
+  return Table;
+};
+} // anonymous namespace
+
+constexpr std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps_64 = PrimaryInstGroupOpsModeLambda(Context::MODE_64BIT);
+constexpr std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps_32 = PrimaryInstGroupOpsModeLambda(Context::MODE_32BIT);
+const X86InstInfo* PrimaryInstGroupOps = PrimaryInstGroupOps_64.data();
 
 }
@@ -14,7 +14,8 @@ $end_info$
 
 namespace FEXCore::X86Tables {
 using namespace InstFlags;
-auto BaseOpsLambda = []() consteval {
+namespace {
+constexpr auto BaseOpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> Table{};
 
   constexpr U8U8InfoStruct TwoByteOpTable[] = {
@@ -276,8 +277,7 @@ auto BaseOpsLambda = []() consteval {
   return Table;
 };
 
-std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps = BaseOpsLambda();
-std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps = []() consteval {
+constexpr auto RepModOpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> Table{};
 
   constexpr U8U8InfoStruct RepModOpTable[] = {
@@ -364,9 +364,9 @@ std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps = []() consteval {
 
   IR::InstallToTable(Table, IR::OpDispatch_SecondaryRepModTables);
   return Table;
-}();
+};
 
-std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps = []() consteval {
+constexpr auto RepNEModOpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> Table{};
 
   constexpr U8U8InfoStruct RepNEModOpTable[] = {
@@ -446,9 +446,9 @@ std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps = []() consteval {
 
   IR::InstallToTable(Table, IR::OpDispatch_SecondaryRepNEModTables);
   return Table;
-}();
+};
 
-std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps = []() consteval {
+constexpr auto OpSizeModOpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> Table{};
 
   constexpr U8U8InfoStruct OpSizeModOpTable[] = {
@@ -602,41 +602,76 @@ std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps = []() consteval
 
   IR::InstallToTable(Table, IR::OpDispatch_SecondaryOpSizeModTables);
   return Table;
-}();
+};
 
-void InitializeSecondaryTables(Context::OperatingMode Mode) {
-  static constexpr U8U8InfoStruct TwoByteOpTable_32[] = {
-    {0xA0, 1, X86InstInfo{"PUSH FS", TYPE_INST, GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
-    {0xA1, 1, X86InstInfo{"POP FS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_DEF) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
+constexpr U8U8InfoStruct TwoByteOpTable_32[] = {
+  {0xA0, 1, X86InstInfo{"PUSH FS", TYPE_INST, GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
+  {0xA1, 1, X86InstInfo{"POP FS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_DEF) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
 
-    {0xA8, 1, X86InstInfo{"PUSH GS", TYPE_INST, GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
-    {0xA9, 1, X86InstInfo{"POP GS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_DEF) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
-  };
+  {0xA8, 1, X86InstInfo{"PUSH GS", TYPE_INST, GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
+  {0xA9, 1, X86InstInfo{"POP GS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_DEF) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                                               0, nullptr}},
+};
 
-  static constexpr U8U8InfoStruct TwoByteOpTable_64[] = {
-    {0xA0, 1, X86InstInfo{"PUSH FS", TYPE_INST, GenFlagsSameSize(SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
-    {0xA1, 1, X86InstInfo{"POP FS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
+constexpr U8U8InfoStruct TwoByteOpTable_64[] = {
+  {0xA0, 1, X86InstInfo{"PUSH FS", TYPE_INST, GenFlagsSameSize(SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
+  {0xA1, 1, X86InstInfo{"POP FS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
 
-    {0xA8, 1, X86InstInfo{"PUSH GS", TYPE_INST, GenFlagsSameSize(SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
-    {0xA9, 1, X86InstInfo{"POP GS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
-  };
+  {0xA8, 1, X86InstInfo{"PUSH GS", TYPE_INST, GenFlagsSameSize(SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
+  {0xA9, 1, X86InstInfo{"POP GS",  TYPE_INST, GenFlagsSizes(SIZE_16BIT, SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY,                                                0, nullptr}},
+};
 
+// The mode specific entries are TYPE_COPY_OTHER in all four tables until the mode is filled in.
+constexpr void LateInitModeTable(auto& Table, Context::OperatingMode Mode) {
   if (Mode == Context::MODE_64BIT) {
-    LateInitCopyTable(&SecondBaseOps.at(0), TwoByteOpTable_64, std::size(TwoByteOpTable_64));
-    LateInitCopyTable(&RepModOps.at(0), TwoByteOpTable_64, std::size(TwoByteOpTable_64));
-    LateInitCopyTable(&RepNEModOps.at(0), TwoByteOpTable_64, std::size(TwoByteOpTable_64));
-    LateInitCopyTable(&OpSizeModOps.at(0), TwoByteOpTable_64, std::size(TwoByteOpTable_64));
-
-    IR::InstallToTable(SecondBaseOps, IR::OpDispatch_TwoByteOpTable_64);
+    LateInitCopyTable(&Table.at(0), TwoByteOpTable_64, std::size(TwoByteOpTable_64));
   }
   else {
-    LateInitCopyTable(&SecondBaseOps.at(0), TwoByteOpTable_32, std::size(TwoByteOpTable_32));
-    LateInitCopyTable(&RepModOps.at(0), TwoByteOpTable_32, std::size(TwoByteOpTable_32));
-    LateInitCopyTable(&RepNEModOps.at(0), TwoByteOpTable_32, std::size(TwoByteOpTable_32));
-    LateInitCopyTable(&OpSizeModOps.at(0), TwoByteOpTable_32, std::size(TwoByteOpTable_32));
-
-    IR::InstallToTable(SecondBaseOps, IR::OpDispatch_TwoByteOpTable_32);
+    LateInitCopyTable(&Table.at(0), TwoByteOpTable_32, std::size(TwoByteOpTable_32));
   }
 }
 
+constexpr auto SecondBaseOpsModeLambda = [](Context::OperatingMode Mode) constexpr {
+  auto Table = BaseOpsLambda();
+  LateInitModeTable(Table, Mode);
+
+  if (Mode == Context::MODE_64BIT) {
+    IR::InstallToTable(Table, IR::OpDispatch_TwoByteOpTable_64);
+  } else {
+    IR::InstallToTable(Table, IR::OpDispatch_TwoByteOpTable_32);
+  }
+  return Table;
+};
+
+constexpr auto RepModOpsModeLambda = [](Context::OperatingMode Mode) constexpr {
+  auto Table = RepModOpsLambda();
+  LateInitModeTable(Table, Mode);
+  return Table;
+};
+
+constexpr auto RepNEModOpsModeLambda = [](Context::OperatingMode Mode) constexpr {
+  auto Table = RepNEModOpsLambda();
+  LateInitModeTable(Table, Mode);
+  return Table;
+};
+
+constexpr auto OpSizeModOpsModeLambda = [](Context::OperatingMode Mode) constexpr {
+  auto Table = OpSizeModOpsLambda();
+  LateInitModeTable(Table, Mode);
+  return Table;
+};
+} // anonymous namespace
+
+constexpr std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps_64 = SecondBaseOpsModeLambda(Context::MODE_64BIT);
+constexpr std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps_32 = SecondBaseOpsModeLambda(Context::MODE_32BIT);
+constexpr std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps_64 = RepModOpsModeLambda(Context::MODE_64BIT);
+constexpr std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps_32 = RepModOpsModeLambda(Context::MODE_32BIT);
+constexpr std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps_64 = RepNEModOpsModeLambda(Context::MODE_64BIT);
+constexpr std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps_32 = RepNEModOpsModeLambda(Context::MODE_32BIT);
+constexpr std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps_64 = OpSizeModOpsModeLambda(Context::MODE_64BIT);
+constexpr std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps_32 = OpSizeModOpsModeLambda(Context::MODE_32BIT);
+
+const X86InstInfo* SecondBaseOps = SecondBaseOps_64.data();
+const X86InstInfo* RepModOps = RepModOps_64.data();
+const X86InstInfo* RepNEModOps = RepNEModOps_64.data();
+const X86InstInfo* OpSizeModOps = OpSizeModOps_64.data();
 }
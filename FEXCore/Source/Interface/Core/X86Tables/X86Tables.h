@@ -59,6 +59,9 @@ constexpr uint32_t FLAG_OPADDR_STACKSIZE = 4; // Two level deep stack
 constexpr uint32_t FLAG_OPADDR_FLAG_SIZE = 2;
 constexpr uint32_t FLAG_OPADDR_MASK = (((1 << FLAG_OPADDR_STACKSIZE) - 1) << FLAG_OPADDR_OFF);
 
+// Set on a `call rel32` whose target is a thunk stub that gets executed inline
+constexpr uint32_t FLAG_INLINE_THUNK_CALL = (1 << (FLAG_OPADDR_OFF + FLAG_OPADDR_STACKSIZE));
+
 // 00 = NONE
 constexpr uint32_t FLAG_OPERAND_SIZE_LAST = 0b01;
 constexpr uint32_t FLAG_WIDENING_SIZE_LAST = 0b10;
@@ -474,27 +477,46 @@ constexpr size_t MAX_XOP_TABLE_SIZE = (1 << 13);
 // group select (2 bits for now) | modrm opcode (3 bits)
 constexpr size_t MAX_XOP_GROUP_TABLE_SIZE = (1 << 6);
 
-extern std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps;
-extern std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps;
-extern std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps;
-extern std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps;
-extern std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps;
-
-extern std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps;
+// Tables that only depend on the operating mode or the x87 precision are fully generated at compile time, once per variant.
+// InitializeInfoTables points these at the variant the process needs, so they stay in read-only data.
+extern const X86InstInfo* BaseOps;
+extern const X86InstInfo* SecondBaseOps;
+extern const X86InstInfo* RepModOps;
+extern const X86InstInfo* RepNEModOps;
+extern const X86InstInfo* OpSizeModOps;
+extern const X86InstInfo* PrimaryInstGroupOps;
+extern const X86InstInfo* X87Ops;
+
+extern const std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps_64;
+extern const std::array<X86InstInfo, MAX_PRIMARY_TABLE_SIZE> BaseOps_32;
+extern const std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps_64;
+extern const std::array<X86InstInfo, MAX_SECOND_TABLE_SIZE> SecondBaseOps_32;
+extern const std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps_64;
+extern const std::array<X86InstInfo, MAX_REP_MOD_TABLE_SIZE> RepModOps_32;
+extern const std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps_64;
+extern const std::array<X86InstInfo, MAX_REPNE_MOD_TABLE_SIZE> RepNEModOps_32;
+extern const std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps_64;
+extern const std::array<X86InstInfo, MAX_OPSIZE_MOD_TABLE_SIZE> OpSizeModOps_32;
+extern const std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps_64;
+extern const std::array<X86InstInfo, MAX_INST_GROUP_TABLE_SIZE> PrimaryInstGroupOps_32;
+extern const std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops_F80;
+extern const std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops_F64;
+
+// Host features install extra handlers in to these, so they need to stay writable.
 extern std::array<X86InstInfo, MAX_INST_SECOND_GROUP_TABLE_SIZE> SecondInstGroupOps;
 extern std::array<X86InstInfo, MAX_SECOND_MODRM_TABLE_SIZE> SecondModRMTableOps;
-extern std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops;
-extern std::array<X86InstInfo, MAX_3DNOW_TABLE_SIZE> DDDNowOps;
 extern std::array<X86InstInfo, MAX_0F_38_TABLE_SIZE> H0F38TableOps;
 extern std::array<X86InstInfo, MAX_0F_3A_TABLE_SIZE> H0F3ATableOps;
 
+extern const std::array<X86InstInfo, MAX_3DNOW_TABLE_SIZE> DDDNowOps;
+
 // VEX
 extern std::array<X86InstInfo, MAX_VEX_TABLE_SIZE> VEXTableOps;
 extern std::array<X86InstInfo, MAX_VEX_GROUP_TABLE_SIZE> VEXTableGroupOps;
 
 // XOP
-extern std::array<X86InstInfo, MAX_XOP_TABLE_SIZE> XOPTableOps;
-extern std::array<X86InstInfo, MAX_XOP_GROUP_TABLE_SIZE> XOPTableGroupOps;
+extern const std::array<X86InstInfo, MAX_XOP_TABLE_SIZE> XOPTableOps;
+extern const std::array<X86InstInfo, MAX_XOP_GROUP_TABLE_SIZE> XOPTableGroupOps;
 
 template <typename OpcodeType>
 struct X86TablesInfoStruct {
@@ -544,7 +566,7 @@ constexpr static inline void GenerateTableWithCopy(X86InstInfo *FinalTable, X86T
 };
 
 template<typename OpcodeType>
-static inline void LateInitCopyTable(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *OtherLocal, size_t OtherTableSize) {
+constexpr static inline void LateInitCopyTable(X86InstInfo *FinalTable, X86TablesInfoStruct<OpcodeType> const *OtherLocal, size_t OtherTableSize) {
   for (size_t j = 0; j < OtherTableSize; ++j) {
     X86TablesInfoStruct<OpcodeType> const &OtherOp = OtherLocal[j];
     auto OtherOpNum = OtherOp.first;
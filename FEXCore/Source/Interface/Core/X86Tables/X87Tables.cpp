@@ -6,12 +6,14 @@ $end_info$
 */
 
 #include "Interface/Core/X86Tables/X86Tables.h"
+#include "Interface/Core/OpcodeDispatcher/X87Tables.h"
 
 #include <iterator>
 
 namespace FEXCore::X86Tables {
 using namespace InstFlags;
-std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops = []() consteval {
+namespace {
+constexpr auto X87OpsLambda = []() consteval {
   std::array<X86InstInfo, MAX_X87_TABLE_SIZE> Table{};
 #define OPD(op, modrmop) (((op - 0xD8) << 8) | modrmop)
 #define OPDReg(op, reg) (((op - 0xD8) << 8) | (reg << 3))
@@ -265,6 +267,22 @@ std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops = []() consteval {
 
   GenerateX87Table(&Table.at(0), X87OpTable, std::size(X87OpTable));
   return Table;
-}();
+};
 
+// Reduced precision uses a completely different set of handlers, selected by the X87ReducedPrecision option.
+constexpr auto X87OpsPrecisionLambda = [](bool ReducedPrecision) constexpr {
+  auto Table = X87OpsLambda();
+
+  if (ReducedPrecision) {
+    IR::InstallToX87Table(Table, IR::OpDispatch_X87F64OpTable);
+  } else {
+    IR::InstallToX87Table(Table, IR::OpDispatch_X87OpTable);
+  }
+  return Table;
+};
+} // anonymous namespace
+
+constexpr std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops_F80 = X87OpsPrecisionLambda(false);
+constexpr std::array<X86InstInfo, MAX_X87_TABLE_SIZE> X87Ops_F64 = X87OpsPrecisionLambda(true);
+const X86InstInfo* X87Ops = X87Ops_F80.data();
 }
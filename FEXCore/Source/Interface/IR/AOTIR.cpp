@@ -10,16 +10,24 @@
 #include <FEXCore/fextl/fmt.h>
 #include <FEXCore/fextl/string.h>
 
+#include <Interface/Core/Frontend.h>
 #include <Interface/Core/LookupCache.h>
 #include <Interface/GDBJIT/GDBJIT.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <mutex>
+#include <string_view>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <xxhash.h>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 
 namespace FEXCore::IR {
 AOTIRInlineEntry* AOTIRInlineIndex::GetInlineEntry(uint64_t DataOffset) {
@@ -48,27 +56,48 @@ AOTIRInlineEntry* AOTIRInlineIndex::Find(uint64_t GuestStart) {
 }
 
 IR::RegisterAllocationData* AOTIRInlineEntry::GetRAData() {
-  return (IR::RegisterAllocationData*)InlineData;
+  return (IR::RegisterAllocationData*)&InlineData[NumExternalBranches * sizeof(int64_t)];
 }
 
 IR::IRListView* AOTIRInlineEntry::GetIRData() {
   auto RAData = GetRAData();
-  auto Offset = RAData->Size(RAData->MapCount);
+  auto Offset = NumExternalBranches * sizeof(int64_t) + RAData->Size(RAData->MapCount);
 
   return (IR::IRListView*)&InlineData[Offset];
 }
 
+size_t AOTIRInlineEntry::GetInlineSize() {
+  auto RAData = GetRAData();
+  return sizeof(*this) + NumExternalBranches * sizeof(int64_t) + RAData->Size(RAData->MapCount) + GetIRData()->GetInlineSize();
+}
+
 void AOTIRCaptureCacheEntry::AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t Start, uint64_t Length, uint64_t Hash,
+                                                     std::optional<uint64_t> ContentKey, const fextl::vector<int64_t>* ExternalBranches,
                                                      const FEXCore::IR::IRListView& IRList, const FEXCore::IR::RegisterAllocationData* RAData) {
-  auto Inserted = Index.emplace(GuestRIP, Stream->Offset());
+  const auto DataOffset = Stream->Offset();
+  auto Inserted = Index.emplace(GuestRIP, DataOffset);
 
   if (Inserted.second) {
     AOTIRInlineEntry entry {
       .GuestHash = Hash,
       .GuestLength = Length,
+      .GuestStartOffset = GuestRIP - Start,
+      .NumExternalBranches = ExternalBranches ? static_cast<uint32_t>(ExternalBranches->size()) : 0,
+      .Flags = ExternalBranches ? AOTIRInlineEntry::FLAG_EXTERNAL_BRANCHES : 0,
     };
     Stream->Write((const char*)&entry, sizeof(entry));
 
+    if (ExternalBranches) {
+      Stream->Write((const char*)ExternalBranches->data(), ExternalBranches->size() * sizeof(int64_t));
+    }
+
+    if (ContentKey) {
+      ContentIndex.emplace_back(AOTIRInlineContentIndexEntry {
+        .ContentKey = *ContentKey,
+        .DataOffset = DataOffset,
+      });
+    }
+
     RAData->Serialize(*Stream);
 
     // IRData (inline)
@@ -76,74 +105,122 @@ void AOTIRCaptureCacheEntry::AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t
   }
 }
 
-static bool readAll(int fd, void* data, size_t size) {
-  int rv = read(fd, data, size);
+void AOTIRCaptureCacheEntry::CopyAOTIRCaptureCache(uint64_t GuestRIP, std::optional<uint64_t> ContentKey, const fextl::vector<uint8_t>& Data) {
+  const auto DataOffset = Stream->Offset();
+  auto Inserted = Index.emplace(GuestRIP, DataOffset);
 
-  if (rv != size) {
-    return false;
-  } else {
-    return true;
+  if (Inserted.second) {
+    // Everything inside an entry is relative to the entry itself, only the index offsets change.
+    Stream->Write(Data.data(), Data.size());
+
+    if (ContentKey) {
+      ContentIndex.emplace_back(AOTIRInlineContentIndexEntry {
+        .ContentKey = *ContentKey,
+        .DataOffset = DataOffset,
+      });
+    }
   }
 }
 
-static bool LoadAOTIRCache(AOTIRCacheEntry* Entry, int streamfd) {
-#ifndef _WIN32
-  uint64_t tag;
+void AOTIRCaptureCacheEntry::FinalizeAOTIRCaptureCache(const fextl::string& ModuleName) {
+  const auto ModSize = ModuleName.size();
 
-  if (!readAll(streamfd, (char*)&tag, sizeof(tag)) || tag != FEXCore::IR::AOTIR_COOKIE) {
-    return false;
+  // pad to 32 bytes
+  constexpr char Zero = 0;
+  while (Stream->Offset() & 31) {
+    Stream->Write(&Zero, 1);
   }
 
-  fextl::string Module;
-  uint64_t ModSize;
-  uint64_t IndexSize;
-
-  lseek(streamfd, -sizeof(ModSize), SEEK_END);
+  std::sort(ContentIndex.begin(), ContentIndex.end(),
+            [](const AOTIRInlineContentIndexEntry& lhs, const AOTIRInlineContentIndexEntry& rhs) { return lhs.ContentKey < rhs.ContentKey; });
+
+  const uint64_t IndexOffset = Stream->Offset();
+  AOTIRInlineIndex index {
+    .Count = Index.size(),
+    .ContentCount = ContentIndex.size(),
+    .DataBase = -Stream->Offset(),
+  };
+  Stream->Write((const char*)&index, sizeof(index));
+
+  for (const auto& [GuestStart, DataOffset] : Index) {
+    AOTIRInlineIndexEntry entry {
+      .GuestStart = GuestStart,
+      .DataOffset = DataOffset,
+    };
 
-  if (!readAll(streamfd, (char*)&ModSize, sizeof(ModSize))) {
-    return false;
+    Stream->Write((const char*)&entry, sizeof(entry));
   }
 
-  Module.resize(ModSize);
+  Stream->Write((const char*)ContentIndex.data(), ContentIndex.size() * sizeof(AOTIRInlineContentIndexEntry));
+
+  const uint64_t ModuleOffset = Stream->Offset();
+  Stream->Write(ModuleName.c_str(), ModSize);
 
-  lseek(streamfd, -sizeof(ModSize) - ModSize, SEEK_END);
+  // End of file trailer
+  AOTIRFileTrailer Trailer {
+    .IndexOffset = IndexOffset,
+    .IndexSize = ModuleOffset - IndexOffset,
+    .ModuleOffset = ModuleOffset,
+    .ModuleSize = ModSize,
+    .Cookie = FEXCore::IR::AOTIR_COOKIE,
+  };
+  Stream->Write((const char*)&Trailer, sizeof(Trailer));
 
-  if (!readAll(streamfd, (char*)&Module[0], Module.size())) {
+  // Close the stream
+  Stream->Close();
+}
+
+bool LoadAOTIRCache(AOTIRCacheEntry* Entry, int streamfd) {
+#ifndef _WIN32
+  struct stat fileinfo;
+  if (fstat(streamfd, &fileinfo) < 0) {
     return false;
   }
 
-  if (Entry->FileId != Module) {
+  const size_t FileSize = fileinfo.st_size;
+  if (FileSize < sizeof(uint64_t) + sizeof(AOTIRFileTrailer)) {
     return false;
   }
 
-  lseek(streamfd, -sizeof(ModSize) - ModSize - sizeof(IndexSize), SEEK_END);
+  // Map the whole file, it is used in place.
+  size_t Size = (FileSize + 4095) & ~4095;
+  void* FilePtr = FEXCore::Allocator::mmap(nullptr, Size, PROT_READ, MAP_SHARED, streamfd, 0);
 
-  if (!readAll(streamfd, (char*)&IndexSize, sizeof(IndexSize))) {
+  if (FilePtr == MAP_FAILED) {
     return false;
   }
 
-  struct stat fileinfo;
-  if (fstat(streamfd, &fileinfo) < 0) {
-    return false;
-  }
-  size_t Size = (fileinfo.st_size + 4095) & ~4095;
+  const auto Base = reinterpret_cast<const uint8_t*>(FilePtr);
+  uint64_t tag;
+  memcpy(&tag, Base, sizeof(tag));
 
-  size_t IndexOffset = fileinfo.st_size - IndexSize - sizeof(ModSize) - ModSize - sizeof(IndexSize);
+  AOTIRFileTrailer Trailer;
+  memcpy(&Trailer, Base + FileSize - sizeof(Trailer), sizeof(Trailer));
 
-  void* FilePtr = FEXCore::Allocator::mmap(nullptr, Size, PROT_READ, MAP_SHARED, streamfd, 0);
+  const auto TrailerOffset = FileSize - sizeof(Trailer);
+  const bool Valid = tag == FEXCore::IR::AOTIR_COOKIE && Trailer.Cookie == FEXCore::IR::AOTIR_COOKIE &&
+                     Trailer.IndexSize >= sizeof(AOTIRInlineIndex) && Trailer.IndexOffset <= TrailerOffset &&
+                     Trailer.IndexSize <= TrailerOffset - Trailer.IndexOffset && Trailer.ModuleOffset <= TrailerOffset &&
+                     Trailer.ModuleSize <= TrailerOffset - Trailer.ModuleOffset &&
+                     std::string_view(reinterpret_cast<const char*>(Base + Trailer.ModuleOffset), Trailer.ModuleSize) == Entry->FileId;
 
-  if (FilePtr == MAP_FAILED) {
+  auto Array = (AOTIRInlineIndex*)(Base + Trailer.IndexOffset);
+
+  if (!Valid || sizeof(AOTIRInlineIndex) + Array->Count * sizeof(AOTIRInlineIndexEntry) +
+                    Array->ContentCount * sizeof(AOTIRInlineContentIndexEntry) != Trailer.IndexSize) {
+    FEXCore::Allocator::munmap(FilePtr, Size);
     return false;
   }
 
-  auto Array = (AOTIRInlineIndex*)((char*)FilePtr + IndexOffset);
+  // Lookups jump around the file. Don't let readahead pull in IR for code that never runs.
+  madvise(FilePtr, Size, MADV_RANDOM);
 
   LOGMAN_THROW_AA_FMT(Entry->Array == nullptr && Entry->FilePtr == nullptr, "Entry must not be initialized here");
   Entry->Array = Array;
   Entry->FilePtr = FilePtr;
   Entry->Size = Size;
 
-  LogMan::Msg::DFmt("AOTIR: Module {} has {} functions", Module, Array->Count);
+  LogMan::Msg::DFmt("AOTIR: Module {} has {} functions", Entry->FileId, Array->Count);
 
   return true;
 #else
@@ -161,44 +238,27 @@ void AOTIRCaptureCache::FinalizeAOTIRCache() {
       continue;
     }
 
-    const auto ModSize = String.size();
-    auto& stream = Entry.Stream;
-
-    // pad to 32 bytes
-    constexpr char Zero = 0;
-    while (stream->Offset() & 31) {
-      stream->Write(&Zero, 1);
-    }
-
-    AOTIRInlineIndex index {
-      .Count = Entry.Index.size(),
-      .DataBase = -stream->Offset(),
-    };
-    stream->Write((const char*)&index, sizeof(index));
-
-    for (const auto& [GuestStart, DataOffset] : Entry.Index) {
-      AOTIRInlineIndexEntry entry {
-        .GuestStart = GuestStart,
-        .DataOffset = DataOffset,
-      };
-
-      stream->Write((const char*)&entry, sizeof(entry));
-    }
-
-    // End of file header
-    const auto IndexSize = sizeof(AOTIRInlineIndex) + index.Count * sizeof(FEXCore::IR::AOTIRInlineIndexEntry);
-    stream->Write((const char*)&IndexSize, sizeof(IndexSize));
-    stream->Write(String.c_str(), ModSize);
-    stream->Write((const char*)&ModSize, sizeof(ModSize));
-
-    // Close the stream
-    stream->Close();
+    Entry.FinalizeAOTIRCaptureCache(String);
 
     // Rename the file to atomically update the cache with the temporary file
     AOTIRRenamer(String);
   }
 }
 
+AOTIRCaptureCacheEntry* AOTIRCaptureCache::GetAOTIRCaptureCacheEntry(const fextl::string& FileId) {
+  // It is guaranteed via AOTIRCaptureCacheWriteoutLock and AOTIRCaptureCacheWriteoutFlusing that this will not run concurrently
+  // Memory coherency is guaranteed via AOTIRCaptureCacheWriteoutLock
+  auto* AotFile = &AOTIRCaptureCacheMap[FileId];
+
+  if (!AotFile->Stream) {
+    AotFile->Stream = AOTIRWriter(FileId);
+    uint64_t tag = FEXCore::IR::AOTIR_COOKIE;
+    AotFile->Stream->Write(&tag, sizeof(tag));
+  }
+
+  return AotFile;
+}
+
 void AOTIRCaptureCache::AOTIRCaptureCacheWriteoutQueue_Flush() {
   {
     std::shared_lock lk {AOTIRCaptureCacheWriteoutLock};
@@ -283,29 +343,84 @@ AOTIRCaptureCache::PreGenerateIRFetch(FEXCore::Core::InternalThreadState* Thread
   if (AOTIRCacheEntry.Entry) {
     AOTIRCacheEntry.Entry->ContainsCode = true;
 
-    if (CTX->Config.AOTIRLoad()) {
+    // AOT generation reuses the previous cache so only code that changed gets regenerated.
+    if (CTX->Config.AOTIRLoad() || CTX->Config.AOTIRGenerate()) {
       auto Mod = AOTIRCacheEntry.Entry->Array;
 
       if (Mod != nullptr) {
+        // Only set while generating. Reused entries need to report their branches so the generator keeps walking.
+        auto ExternalBranches = Thread->FrontendDecoder->GetExternalBranches();
+        const uint64_t SectionMaxAddress = Thread->FrontendDecoder->GetSectionMaxAddress();
+
         auto AOTEntry = Mod->Find(GuestRIP - AOTIRCacheEntry.VAFileStart);
 
         if (AOTEntry) {
           // verify hash
-          auto MappedStart = GuestRIP;
+          auto MappedStart = GuestRIP - AOTEntry->GuestStartOffset;
           auto hash = XXH3_64bits((void*)MappedStart, AOTEntry->GuestLength);
-          if (hash == AOTEntry->GuestHash) {
-            Result.IR = fextl::make_unique<IRInlineStorage>(*AOTEntry);
-            // LogMan::Msg::DFmt("using {} + {:x} -> {:x}\n", file->second.fileid, AOTEntry->first, GuestRIP);
-            Result.DebugData = new FEXCore::Core::DebugData();
-            Result.StartAddr = MappedStart;
-            Result.Length = AOTEntry->GuestLength;
-            return Result;
-          } else {
+          if (hash != AOTEntry->GuestHash) {
             LogMan::Msg::IFmt("AOTIR: hash check failed {:x}\n", MappedStart);
+            AOTEntry = nullptr;
+          } else if (ExternalBranches && !(AOTEntry->Flags & AOTIRInlineEntry::FLAG_EXTERNAL_BRANCHES)) {
+            // Captured while running, doesn't know where it branches to.
+            AOTEntry = nullptr;
           }
         } else {
           // LogMan::Msg::IFmt("AOTIR: Failed to find {:x}, {:x}, {}\n", GuestRIP, GuestRIP - file->second.Start + file->second.Offset, file->second.fileid);
         }
+
+        if (!AOTEntry && ExternalBranches && GuestRIP + AOTIR_CONTENT_KEY_SIZE <= SectionMaxAddress) {
+          // The file may have been rebuilt since the cache was generated, moving unchanged functions around.
+          // The IR is relative to the entrypoint so it can be reused at the new location.
+          auto ContentKey = XXH3_64bits((void*)GuestRIP, AOTIR_CONTENT_KEY_SIZE);
+          AOTEntry = Mod->FindContent(ContentKey, [GuestRIP, SectionMaxAddress](AOTIRInlineEntry* Candidate) {
+            return Candidate->GuestStartOffset == 0 && (Candidate->Flags & AOTIRInlineEntry::FLAG_EXTERNAL_BRANCHES) &&
+                   GuestRIP + Candidate->GuestLength <= SectionMaxAddress &&
+                   XXH3_64bits((void*)GuestRIP, Candidate->GuestLength) == Candidate->GuestHash;
+          });
+        }
+
+        if (AOTEntry) {
+          if (ExternalBranches) {
+            auto Branches = AOTEntry->GetExternalBranches();
+            for (size_t i = 0; i < AOTEntry->NumExternalBranches; ++i) {
+              ExternalBranches->insert(GuestRIP + Branches[i]);
+            }
+          }
+
+          if (ExternalBranches && CTX->Config.AOTIRGenerate()) {
+            // Nothing runs while generating, so there's no need to compile the entry.
+            // Copy it to the new cache as is, it would otherwise be lost when the new cache replaces this one.
+            const uint64_t StartAddr = GuestRIP - AOTEntry->GuestStartOffset;
+            std::optional<uint64_t> ContentKey;
+            if (GuestRIP + AOTIR_CONTENT_KEY_SIZE <= StartAddr + AOTEntry->GuestLength) {
+              ContentKey = XXH3_64bits((void*)GuestRIP, AOTIR_CONTENT_KEY_SIZE);
+            }
+
+            auto LocalRIP = GuestRIP - AOTIRCacheEntry.VAFileStart;
+            auto FileId = AOTIRCacheEntry.Entry->FileId;
+
+            // The lambda is converted to std::function. This is tricky to refactor so it doesn't allocate memory through glibc.
+            FEXCore::Allocator::YesIKnowImNotSupposedToUseTheGlibcAllocator glibc;
+
+            // The previous cache may be unmapped before the writeout queue is flushed, take a copy.
+            auto EntryData = reinterpret_cast<const uint8_t*>(AOTEntry);
+            fextl::vector<uint8_t> Data(EntryData, EntryData + AOTEntry->GetInlineSize());
+            AOTIRCaptureCacheWriteoutQueue_Append([this, LocalRIP, ContentKey, Data = std::move(Data), FileId]() {
+              GetAOTIRCaptureCacheEntry(FileId)->CopyAOTIRCaptureCache(LocalRIP, ContentKey, Data);
+            });
+
+            Result.CopiedToCapture = true;
+            return Result;
+          }
+
+          Result.IR = fextl::make_unique<IRInlineStorage>(*AOTEntry);
+          // LogMan::Msg::DFmt("using {} + {:x} -> {:x}\n", file->second.fileid, AOTEntry->first, GuestRIP);
+          Result.DebugData = new FEXCore::Core::DebugData();
+          Result.StartAddr = GuestRIP - AOTEntry->GuestStartOffset;
+          Result.Length = AOTEntry->GuestLength;
+          return Result;
+        }
       }
     }
   }
@@ -336,6 +451,11 @@ bool AOTIRCaptureCache::PostCompileCode(FEXCore::Core::InternalThreadState* Thre
 
         auto hash = XXH3_64bits((void*)StartAddr, Length);
 
+        std::optional<uint64_t> ContentKey;
+        if (GuestRIP + AOTIR_CONTENT_KEY_SIZE <= StartAddr + Length) {
+          ContentKey = XXH3_64bits((void*)GuestRIP, AOTIR_CONTENT_KEY_SIZE);
+        }
+
         auto LocalRIP = GuestRIP - AOTIRCacheEntry.VAFileStart;
         auto LocalStartAddr = StartAddr - AOTIRCacheEntry.VAFileStart;
         auto FileId = AOTIRCacheEntry.Entry->FileId;
@@ -343,20 +463,23 @@ bool AOTIRCaptureCache::PostCompileCode(FEXCore::Core::InternalThreadState* Thre
         // The lambda is converted to std::function. This is tricky to refactor so it doesn't allocate memory through glibc.
         // NOTE: unique_ptr must be passed as a raw pointer since std::function requires lambda captures to be copyable
         FEXCore::Allocator::YesIKnowImNotSupposedToUseTheGlibcAllocator glibc;
-        AOTIRCaptureCacheWriteoutQueue_Append([this, LocalRIP, LocalStartAddr, Length, hash, IRRaw = IR.release(), FileId]() {
-          fextl::unique_ptr<FEXCore::IR::IRStorageBase> IR(IRRaw);
 
-          // It is guaranteed via AOTIRCaptureCacheWriteoutLock and AOTIRCaptureCacheWriteoutFlusing that this will not run concurrently
-          // Memory coherency is guaranteed via AOTIRCaptureCacheWriteoutLock
+        // While generating, remember where this entry branches to so reusing it later can continue the walk.
+        std::optional<fextl::vector<int64_t>> ExternalBranches;
+        if (auto Branches = Thread->FrontendDecoder->GetExternalBranches()) {
+          ExternalBranches.emplace();
+          for (auto Destination : *Branches) {
+            ExternalBranches->push_back(Destination - GuestRIP);
+          }
+        }
 
-          auto* AotFile = &AOTIRCaptureCacheMap[FileId];
+        AOTIRCaptureCacheWriteoutQueue_Append([this, LocalRIP, LocalStartAddr, Length, hash, ContentKey, ExternalBranches, IRRaw = IR.release(),
+                                               FileId]() {
+          fextl::unique_ptr<FEXCore::IR::IRStorageBase> IR(IRRaw);
 
-          if (!AotFile->Stream) {
-            AotFile->Stream = AOTIRWriter(FileId);
-            uint64_t tag = FEXCore::IR::AOTIR_COOKIE;
-            AotFile->Stream->Write(&tag, sizeof(tag));
-          }
-          AotFile->AppendAOTIRCaptureCache(LocalRIP, LocalStartAddr, Length, hash, IR->GetIRView(), IR->RAData());
+          auto* AotFile = GetAOTIRCaptureCacheEntry(FileId);
+          AotFile->AppendAOTIRCaptureCache(LocalRIP, LocalStartAddr, Length, hash, ContentKey, ExternalBranches ? &*ExternalBranches : nullptr,
+                                           IR->GetIRView(), IR->RAData());
         });
 
         if (CTX->Config.AOTIRGenerate()) {
@@ -394,7 +517,7 @@ AOTIRCacheEntry* AOTIRCaptureCache::LoadAOTIRCacheEntry(const fextl::string& fil
 
     LOGMAN_THROW_AA_FMT(Entry->Array == nullptr, "Duplicate LoadAOTIRCacheEntry");
 
-    if (CTX->Config.AOTIRLoad && AOTIRLoader) {
+    if ((CTX->Config.AOTIRLoad || CTX->Config.AOTIRGenerate) && AOTIRLoader) {
       auto streamfd = AOTIRLoader(fileid);
       if (streamfd != -1) {
         FEXCore::IR::LoadAOTIRCache(Entry, streamfd);
@@ -9,11 +9,14 @@
 #include <FEXCore/fextl/string.h>
 #include <FEXCore/fextl/queue.h>
 #include <FEXCore/fextl/unordered_map.h>
+#include <FEXCore/fextl/vector.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <FEXCore/HLE/SourcecodeResolver.h>
 
@@ -68,18 +71,60 @@ constexpr auto COOKIE_VERSION = [](const char CookieText[4], uint32_t Version) {
 
   return Cookie;
 };
-constexpr static uint32_t AOTIR_VERSION = 0x0000'00004;
+constexpr static uint32_t AOTIR_VERSION = 0x0000'00006;
 constexpr static uint64_t AOTIR_COOKIE = COOKIE_VERSION("FEXI", AOTIR_VERSION);
 
+// Number of guest bytes at an entrypoint used as its content key.
+// Lets AOT generation find an unchanged function again after the file it is in has been rebuilt and the function moved.
+constexpr static size_t AOTIR_CONTENT_KEY_SIZE = 32;
+// Functions commonly start with the same prologue, limit how many full hashes one content lookup may check.
+constexpr static size_t AOTIR_MAX_CONTENT_CANDIDATES = 8;
+
+/**
+ * @brief AOTIR file layout
+ *
+ * AOTIR_COOKIE
+ * AOTIRInlineEntry data, each followed by its branches, RAData and IRData
+ * AOTIRInlineIndex, 32 byte aligned
+ * Module name
+ * AOTIRFileTrailer
+ *
+ * The whole file is mapped and used in place. Nothing is decoded up front, an entry's pages are only touched once its RIP is compiled.
+ */
+struct AOTIRFileTrailer {
+  uint64_t IndexOffset;
+  uint64_t IndexSize;
+  uint64_t ModuleOffset;
+  uint64_t ModuleSize;
+  // Repeated so truncated files get rejected.
+  uint64_t Cookie;
+};
+
 struct AOTIRInlineEntry {
+  // Hash and length of the guest code the IR was generated from, starting GuestStartOffset bytes before the entrypoint.
   uint64_t GuestHash;
   uint64_t GuestLength;
+  uint64_t GuestStartOffset;
+
+  // Branch targets leaving this entry, relative to the entrypoint. Only recorded by AOT generation.
+  uint32_t NumExternalBranches;
+  uint32_t Flags;
+
+  enum Flag : uint32_t {
+    FLAG_EXTERNAL_BRANCHES = 1U << 0,
+  };
 
-  /* RAData followed by IRData */
+  /* ExternalBranches followed by RAData followed by IRData */
   uint8_t InlineData[0];
 
+  const int64_t* GetExternalBranches() const {
+    return reinterpret_cast<const int64_t*>(InlineData);
+  }
   IR::RegisterAllocationData* GetRAData();
   IR::IRListView* GetIRData();
+
+  // Size of the entry including its inline data.
+  size_t GetInlineSize();
 };
 
 struct AOTIRInlineIndexEntry {
@@ -87,21 +132,62 @@ struct AOTIRInlineIndexEntry {
   uint64_t DataOffset;
 };
 
+struct AOTIRInlineContentIndexEntry {
+  uint64_t ContentKey;
+  uint64_t DataOffset;
+};
+
 struct AOTIRInlineIndex {
   uint64_t Count;
+  uint64_t ContentCount;
   uint64_t DataBase;
+  /* Entries sorted by GuestStart followed by ContentCount AOTIRInlineContentIndexEntry sorted by ContentKey */
   AOTIRInlineIndexEntry Entries[0];
 
   AOTIRInlineEntry* Find(uint64_t GuestStart);
   AOTIRInlineEntry* GetInlineEntry(uint64_t DataOffset);
+
+  /**
+   * @brief Finds an entry by the content key of its entrypoint
+   *
+   * @param Verify - Called for each candidate with a matching key, returns true if the candidate matches
+   */
+  template<typename VerifyFn>
+  AOTIRInlineEntry* FindContent(uint64_t ContentKey, VerifyFn&& Verify) {
+    auto ContentEntries = reinterpret_cast<const AOTIRInlineContentIndexEntry*>(&Entries[Count]);
+    auto End = ContentEntries + ContentCount;
+    auto It = std::lower_bound(ContentEntries, End, ContentKey,
+                               [](const AOTIRInlineContentIndexEntry& lhs, uint64_t rhs) { return lhs.ContentKey < rhs; });
+
+    for (size_t i = 0; It != End && It->ContentKey == ContentKey && i < AOTIR_MAX_CONTENT_CANDIDATES; ++It, ++i) {
+      auto Entry = GetInlineEntry(It->DataOffset);
+      if (Verify(Entry)) {
+        return Entry;
+      }
+    }
+
+    return nullptr;
+  }
 };
 
 struct AOTIRCaptureCacheEntry {
   fextl::unique_ptr<FEXCore::Context::AOTIRWriter> Stream;
   fextl::map<uint64_t, uint64_t> Index;
+  fextl::vector<AOTIRInlineContentIndexEntry> ContentIndex;
 
-  void AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t Start, uint64_t Length, uint64_t Hash, const FEXCore::IR::IRListView& IRList,
+  void AppendAOTIRCaptureCache(uint64_t GuestRIP, uint64_t Start, uint64_t Length, uint64_t Hash, std::optional<uint64_t> ContentKey,
+                               const fextl::vector<int64_t>* ExternalBranches, const FEXCore::IR::IRListView& IRList,
                                const FEXCore::IR::RegisterAllocationData* RAData);
+
+  /**
+   * @brief Appends an entry taken from a previous cache as is
+   *
+   * @param Data - Copy of the AOTIRInlineEntry and its inline data
+   */
+  void CopyAOTIRCaptureCache(uint64_t GuestRIP, std::optional<uint64_t> ContentKey, const fextl::vector<uint8_t>& Data);
+
+  // Writes the index and trailer, then closes the stream.
+  void FinalizeAOTIRCaptureCache(const fextl::string& ModuleName);
 };
 
 struct AOTIRCacheEntry {
@@ -116,6 +202,13 @@ struct AOTIRCacheEntry {
 
 using AOTCacheType = fextl::unordered_map<fextl::string, FEXCore::IR::AOTIRCacheEntry>;
 
+/**
+ * @brief Maps an AOTIR cache file in to Entry
+ *
+ * @return false if the file isn't a valid cache for Entry->FileId
+ */
+bool LoadAOTIRCache(AOTIRCacheEntry* Entry, int streamfd);
+
 class AOTIRCaptureCache final {
 public:
   using WriteOutFn = std::function<void()>;
@@ -133,6 +226,8 @@ public:
     FEXCore::Core::DebugData* DebugData {};
     uint64_t StartAddr {};
     uint64_t Length {};
+    // AOT generation copied the cached entry straight to the new cache. There is nothing left to compile.
+    bool CopiedToCapture {};
   };
   [[nodiscard]]
   std::optional<PreGenerateIRFetchResult> PreGenerateIRFetch(FEXCore::Core::InternalThreadState* Thread, uint64_t GuestRIP);
@@ -159,6 +254,9 @@ public:
 private:
   FEXCore::Context::ContextImpl* CTX;
 
+  // Only called from the writeout queue.
+  AOTIRCaptureCacheEntry* GetAOTIRCaptureCacheEntry(const fextl::string& FileId);
+
   std::shared_mutex AOTIRCacheLock;
   std::shared_mutex AOTIRCaptureCacheWriteoutLock;
   std::atomic<bool> AOTIRCaptureCacheWriteoutFlusing;
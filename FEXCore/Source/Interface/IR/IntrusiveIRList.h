@@ -152,8 +152,9 @@ public:
   IRListView(DualIntrusiveAllocator* Data)
     : IRListView(reinterpret_cast<void*>(Data->DataBegin()), reinterpret_cast<void*>(Data->ListBegin()), Data->DataSize(), Data->ListSize()) {}
 
+  // Old may be a serialized view with its data inline, so go through the accessors.
   IRListView(IRListView* Old)
-    : IRListView(Old->IRDataInternal, Old->ListDataInternal, Old->DataSize, Old->ListSize) {}
+    : IRListView(reinterpret_cast<void*>(Old->GetData()), reinterpret_cast<void*>(Old->GetListData()), Old->DataSize, Old->ListSize) {}
 
   IRListView(void* IRData_, void* ListData_, size_t DataSize_, size_t ListSize_)
     : IRDataInternal(IRData_)
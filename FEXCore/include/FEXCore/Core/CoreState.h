@@ -251,6 +251,7 @@ struct JITPointers {
     uint64_t XCRFunction {};
     uint64_t SyscallHandlerObj {};
     uint64_t SyscallHandlerFunc {};
+    uint64_t InlineSyscallTable {};
     uint64_t ExitFunctionLink {};
 
     // Handles returning/calling ARM64EC code from the JIT, expects the target PC in TMP3
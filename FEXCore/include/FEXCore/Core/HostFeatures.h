@@ -25,6 +25,9 @@ struct HostFeatures {
   bool SupportsAVX {};
   bool SupportsSVE128 {};
   bool SupportsSVE256 {};
+  // Guest YMM registers are held natively in SVE registers.
+  // Otherwise each 256-bit operation is split in to 128-bit halves.
+  bool SupportsAVX256 {};
   bool SupportsSHA {};
   bool SupportsPMULL_128Bit {};
   bool SupportsCSSC {};
@@ -35,6 +38,7 @@ struct HostFeatures {
   bool SupportsPreserveAllABI {};
   bool SupportsAES256 {};
   bool SupportsSVEBitPerm {};
+  bool SupportsWFXT {};
 
   // Float exception behaviour
   bool SupportsAFP {};
@@ -2,6 +2,7 @@
 #pragma once
 #include <cstdint>
 #include <shared_mutex>
+#include <span>
 
 #include <FEXCore/IR/IR.h>
 
@@ -67,11 +68,20 @@ public:
   virtual FEXCore::IR::SyscallFlags GetSyscallFlags(uint64_t Syscall) const {
     return FEXCore::IR::SyscallFlags::DEFAULT;
   }
+  // Host syscall numbers indexed by guest syscall number, or -1 for syscalls that must go through HandleSyscall.
+  // Allows the JIT to pass syscalls through without the handler when the syscall number isn't known at compile time.
+  virtual std::span<const int32_t> GetInlineSyscallTable() const {
+    return {};
+  }
 
   SyscallOSABI GetOSABI() const {
     return OSABI;
   }
   virtual void MarkGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) {}
+  // Returns true if the range is mapped readable and executable in the guest, so the frontend may read it ahead of execution
+  virtual bool IsGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) {
+    return false;
+  }
   virtual void MarkOvercommitRange(uint64_t Start, uint64_t Length) {}
   virtual void UnmarkOvercommitRange(uint64_t Start, uint64_t Length) {}
   virtual AOTIRCacheEntryLookupResult LookupAOTIRCacheEntry(FEXCore::Core::InternalThreadState* Thread, uint64_t GuestAddr) = 0;
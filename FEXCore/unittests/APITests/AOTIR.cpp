@@ -0,0 +1,162 @@
+#include "Interface/IR/AOTIR.h"
+#include "Interface/IR/IREmitter.h"
+
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Utils/ThreadPoolAllocator.h>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace FEXCore::IR;
+
+namespace {
+constexpr char ModuleName[] = "test-module";
+
+// Writes the cache in to a memfd so it can be mapped again like a cache file.
+class MemFDWriter final : public FEXCore::Context::AOTIRWriter {
+public:
+  MemFDWriter(int FD)
+    : FD {FD} {}
+
+  void Write(const void* Data, size_t Size) override {
+    REQUIRE(write(FD, Data, Size) == static_cast<ssize_t>(Size));
+  }
+
+  size_t Offset() override {
+    return lseek(FD, 0, SEEK_CUR);
+  }
+
+  void Close() override {}
+
+private:
+  int FD;
+};
+
+// One function worth of IR that exits with Value.
+class TestFunction final {
+public:
+  TestFunction(uint64_t Value) {
+    auto Header = IREmit._IRHeader(IREmit.Invalid(), 0, 0, 0);
+    auto Block = IREmit.CreateCodeNode();
+    Header.first->Blocks = IREmit.WrapNode(Block);
+    IREmit.SetCurrentCodeBlock(Block);
+    IREmit._ExitFunction(IREmit._Constant(Value));
+    RAData = RegisterAllocationData::Create(IREmit.ViewIR().GetSSACount());
+  }
+
+  void Append(AOTIRCaptureCacheEntry& Cache, uint64_t GuestRIP, uint64_t Hash, std::optional<uint64_t> ContentKey,
+              const fextl::vector<int64_t>& ExternalBranches) {
+    Cache.AppendAOTIRCaptureCache(GuestRIP, GuestRIP, 0x40, Hash, ContentKey, &ExternalBranches, IREmit.ViewIR(), RAData.get());
+  }
+
+private:
+  FEXCore::Utils::PooledAllocatorMalloc Allocator;
+  IREmitter IREmit {Allocator};
+  RegisterAllocationData::UniquePtr RAData;
+};
+
+class TestCache final {
+public:
+  TestCache() {
+    FD = memfd_create("AOTIRTest", MFD_CLOEXEC);
+    REQUIRE(FD != -1);
+    Capture.Stream = fextl::make_unique<MemFDWriter>(FD);
+    uint64_t tag = AOTIR_COOKIE;
+    Capture.Stream->Write(&tag, sizeof(tag));
+  }
+
+  ~TestCache() {
+    if (Entry.Array) {
+      AOTIRCaptureCache(nullptr).UnloadAOTIRCacheEntry(&Entry);
+    }
+    close(FD);
+  }
+
+  bool Load() {
+    Capture.FinalizeAOTIRCaptureCache(ModuleName);
+    // Loaded like a freshly opened cache file.
+    lseek(FD, 0, SEEK_SET);
+    return LoadAOTIRCache(&Entry, FD);
+  }
+
+  AOTIRCaptureCacheEntry Capture;
+  AOTIRCacheEntry Entry {.FileId = ModuleName};
+
+private:
+  int FD {-1};
+};
+
+fextl::vector<uint8_t> CopyEntry(AOTIRInlineEntry* Entry) {
+  auto Data = reinterpret_cast<const uint8_t*>(Entry);
+  return fextl::vector<uint8_t>(Data, Data + Entry->GetInlineSize());
+}
+} // namespace
+
+TEST_CASE("AOTIR - Regenerating keeps unchanged functions") {
+  TestFunction A {1}, B {2}, C {3}, NewB {4};
+
+  // First generation
+  TestCache First;
+  A.Append(First.Capture, 0x1000, 0xAAAA, 0xA, {0x10});
+  B.Append(First.Capture, 0x2000, 0xBBBB, 0xB, {-0x1000});
+  C.Append(First.Capture, 0x3000, 0xCCCC, std::nullopt, {});
+  REQUIRE(First.Load());
+  REQUIRE(First.Entry.Array->Count == 3);
+  REQUIRE(First.Entry.Array->ContentCount == 2);
+
+  auto OldA = First.Entry.Array->Find(0x1000);
+  auto OldC = First.Entry.Array->Find(0x3000);
+  REQUIRE(OldA);
+  REQUIRE(OldC);
+
+  // Regenerate. Only B changed, A and C are carried over as is.
+  TestCache Second;
+  Second.Capture.CopyAOTIRCaptureCache(0x1000, 0xA, CopyEntry(OldA));
+  NewB.Append(Second.Capture, 0x2000, 0xBEEF, 0xB, {});
+  Second.Capture.CopyAOTIRCaptureCache(0x3000, std::nullopt, CopyEntry(OldC));
+  REQUIRE(Second.Load());
+  REQUIRE(Second.Entry.Array->Count == 3);
+  REQUIRE(Second.Entry.Array->ContentCount == 2);
+
+  auto NewA = Second.Entry.Array->Find(0x1000);
+  auto NewC = Second.Entry.Array->Find(0x3000);
+  REQUIRE(NewA);
+  REQUIRE(NewC);
+  CHECK(NewA->GetInlineSize() == OldA->GetInlineSize());
+  CHECK(memcmp(NewA, OldA, OldA->GetInlineSize()) == 0);
+  CHECK(NewC->GetInlineSize() == OldC->GetInlineSize());
+  CHECK(memcmp(NewC, OldC, OldC->GetInlineSize()) == 0);
+
+  // Inline data is still usable at its new offset
+  CHECK(NewA->GuestHash == 0xAAAA);
+  REQUIRE(NewA->NumExternalBranches == 1);
+  CHECK(NewA->GetExternalBranches()[0] == 0x10);
+  CHECK(NewA->GetIRData()->GetSSACount() == OldA->GetIRData()->GetSSACount());
+  CHECK(NewA->GetRAData()->MapCount == OldA->GetRAData()->MapCount);
+
+  auto RegeneratedB = Second.Entry.Array->Find(0x2000);
+  REQUIRE(RegeneratedB);
+  CHECK(RegeneratedB->GuestHash == 0xBEEF);
+  CHECK(RegeneratedB->NumExternalBranches == 0);
+
+  // The content index points at the copied entry
+  auto ByContent = Second.Entry.Array->FindContent(0xA, [](AOTIRInlineEntry* Candidate) { return Candidate->GuestHash == 0xAAAA; });
+  CHECK(ByContent == NewA);
+}
+
+TEST_CASE("AOTIR - Copied entries don't replace existing ones") {
+  TestFunction A {1}, B {2};
+
+  TestCache First;
+  A.Append(First.Capture, 0x1000, 0xAAAA, std::nullopt, {});
+  REQUIRE(First.Load());
+
+  TestCache Second;
+  B.Append(Second.Capture, 0x1000, 0xBBBB, std::nullopt, {});
+  Second.Capture.CopyAOTIRCaptureCache(0x1000, std::nullopt, CopyEntry(First.Entry.Array->Find(0x1000)));
+  REQUIRE(Second.Load());
+  REQUIRE(Second.Entry.Array->Count == 1);
+  CHECK(Second.Entry.Array->Find(0x1000)->GuestHash == 0xBBBB);
+}
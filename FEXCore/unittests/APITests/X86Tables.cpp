@@ -0,0 +1,189 @@
+#include "Interface/Core/OpcodeDispatcher.h"
+#include "Interface/Core/X86Tables/X86Tables.h"
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+
+using namespace FEXCore::X86Tables;
+using namespace FEXCore::X86Tables::InstFlags;
+using FEXCore::IR::OpDispatchBuilder;
+
+namespace {
+struct ExpectedEntry {
+  uint16_t Index;
+  const char* Name;
+  InstType Type;
+  uint8_t MoreBytes;
+};
+
+template<size_t Size>
+void CheckEntries(const std::array<X86InstInfo, Size>& Table, std::initializer_list<ExpectedEntry> Expected) {
+  for (const auto& Entry : Expected) {
+    const auto& Info = Table.at(Entry.Index);
+    INFO("Index 0x" << std::hex << Entry.Index << ": " << (Info.Name ?: "<null>") << " expected " << Entry.Name);
+
+    REQUIRE(Info.Name != nullptr);
+    CHECK(strcmp(Info.Name, Entry.Name) == 0);
+    CHECK(Info.Type == Entry.Type);
+    CHECK(Info.MoreBytes == Entry.MoreBytes);
+    if (Entry.Type == TYPE_INST) {
+      CHECK(Info.OpcodeDispatcher != nullptr);
+    } else {
+      CHECK(Info.OpcodeDispatcher == nullptr);
+    }
+  }
+}
+
+// Index of a primary group 1 entry, group 1 is the first group so it has no group offset.
+constexpr uint16_t Group1Index(uint8_t Op, uint8_t Reg) {
+  return (OpToIndex(Op) << 3) | Reg;
+}
+} // namespace
+
+TEST_CASE("X86Tables - BaseOps") {
+  CheckEntries(BaseOps_64, {
+                             {0x06, "[INV]", TYPE_INVALID, 0},
+                             {0x0E, "[INV]", TYPE_INVALID, 0},
+                             {0x27, "[INV]", TYPE_INVALID, 0},
+                             {0x37, "[INV]", TYPE_INVALID, 0},
+                             {0x60, "[INV]", TYPE_INVALID, 0},
+                             {0x63, "MOVSXD", TYPE_INST, 0},
+                             {0x9A, "[INV]", TYPE_INVALID, 0},
+                             {0xA0, "MOV", TYPE_INST, 8},
+                             {0xA3, "MOV", TYPE_INST, 8},
+                             {0xCE, "[INV]", TYPE_INVALID, 0},
+                             {0xD4, "[INV]", TYPE_INVALID, 0},
+                             {0xD6, "[INV]", TYPE_INVALID, 0},
+                             {0xEA, "[INV]", TYPE_INVALID, 0},
+                           });
+
+  CheckEntries(BaseOps_32, {
+                             {0x06, "PUSH ES", TYPE_INST, 0},
+                             {0x0E, "PUSH CS", TYPE_INST, 0},
+                             {0x27, "DAA", TYPE_INST, 0},
+                             {0x37, "AAA", TYPE_INST, 0},
+                             {0x40, "INC", TYPE_INST, 0},
+                             {0x48, "DEC", TYPE_INST, 0},
+                             {0x60, "PUSHA", TYPE_INST, 0},
+                             {0x63, "ARPL", TYPE_INVALID, 0},
+                             {0x9A, "CALLF", TYPE_INST, 0},
+                             {0xA0, "MOV", TYPE_INST, 4},
+                             {0xA3, "MOV", TYPE_INST, 4},
+                             {0xCE, "INTO", TYPE_INST, 0},
+                             {0xD4, "AAM", TYPE_INST, 1},
+                             {0xD6, "SALC", TYPE_INST, 0},
+                             {0xEA, "JMPF", TYPE_INST, 0},
+                           });
+
+  // REX prefixes only exist in 64-bit mode
+  for (uint16_t Op = 0x40; Op < 0x50; ++Op) {
+    CHECK(BaseOps_64[Op].Type == TYPE_REX_PREFIX);
+    CHECK(BaseOps_32[Op].Type == TYPE_INST);
+  }
+
+  // Entries shared by both modes
+  CHECK(BaseOps_64[0xC4].Type == TYPE_VEX_TABLE_PREFIX);
+  CHECK(BaseOps_32[0xC4].Type == TYPE_VEX_TABLE_PREFIX);
+  CHECK(BaseOps_64[0x05].OpcodeDispatcher == BaseOps_32[0x05].OpcodeDispatcher);
+
+  // Handlers from the mode specific dispatch tables
+  CHECK(BaseOps_64[0x63].OpcodeDispatcher == &OpDispatchBuilder::MOVSXDOp);
+  CHECK(BaseOps_64[0xA0].OpcodeDispatcher == &OpDispatchBuilder::MOVOffsetOp);
+  CHECK(BaseOps_32[0xA0].OpcodeDispatcher == &OpDispatchBuilder::MOVOffsetOp);
+  CHECK(BaseOps_32[0x27].OpcodeDispatcher == &OpDispatchBuilder::DAAOp);
+  CHECK(BaseOps_32[0x47].OpcodeDispatcher == &OpDispatchBuilder::INCOp);
+  CHECK(BaseOps_32[0x4F].OpcodeDispatcher == &OpDispatchBuilder::DECOp);
+  CHECK(BaseOps_32[0xCE].OpcodeDispatcher == &OpDispatchBuilder::INTOp);
+}
+
+TEST_CASE("X86Tables - SecondaryOps") {
+  // The segment register entries are filled in from the mode table in the base and every prefixed table.
+  std::initializer_list<ExpectedEntry> SegmentOps = {
+    {0xA0, "PUSH FS", TYPE_INST, 0},
+    {0xA1, "POP FS", TYPE_INST, 0},
+    {0xA8, "PUSH GS", TYPE_INST, 0},
+    {0xA9, "POP GS", TYPE_INST, 0},
+  };
+
+  CheckEntries(SecondBaseOps_64, SegmentOps);
+  CheckEntries(SecondBaseOps_32, SegmentOps);
+  CheckEntries(RepModOps_64, SegmentOps);
+  CheckEntries(RepModOps_32, SegmentOps);
+  CheckEntries(RepNEModOps_64, SegmentOps);
+  CheckEntries(RepNEModOps_32, SegmentOps);
+  CheckEntries(OpSizeModOps_64, SegmentOps);
+  CheckEntries(OpSizeModOps_32, SegmentOps);
+
+  constexpr auto PushFlags_64 = GenFlagsSameSize(SIZE_64BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY;
+  constexpr auto PushFlags_32 = GenFlagsSrcSize(SIZE_16BIT) | FLAGS_DEBUG_MEM_ACCESS | FLAGS_NO_OVERLAY;
+  for (uint16_t Op : {0xA0, 0xA8}) {
+    INFO("Op 0x" << std::hex << Op);
+    CHECK(SecondBaseOps_64[Op].Flags == PushFlags_64);
+    CHECK(RepModOps_64[Op].Flags == PushFlags_64);
+    CHECK(RepNEModOps_64[Op].Flags == PushFlags_64);
+    CHECK(OpSizeModOps_64[Op].Flags == PushFlags_64);
+
+    CHECK(SecondBaseOps_32[Op].Flags == PushFlags_32);
+    CHECK(RepModOps_32[Op].Flags == PushFlags_32);
+    CHECK(RepNEModOps_32[Op].Flags == PushFlags_32);
+    CHECK(OpSizeModOps_32[Op].Flags == PushFlags_32);
+  }
+
+  // SYSCALL is a NOP in 32-bit mode
+  CHECK(SecondBaseOps_32[0x05].OpcodeDispatcher == &OpDispatchBuilder::NOPOp);
+  CHECK(SecondBaseOps_64[0x05].OpcodeDispatcher != nullptr);
+  CHECK(SecondBaseOps_64[0x05].OpcodeDispatcher != &OpDispatchBuilder::NOPOp);
+}
+
+TEST_CASE("X86Tables - PrimaryInstGroupOps") {
+  constexpr const char* Group1Names[] = {"ADD", "OR", "ADC", "SBB", "AND", "SUB", "XOR", "CMP"};
+
+  for (uint8_t Reg = 0; Reg < 8; ++Reg) {
+    INFO("Reg " << int(Reg));
+
+    // 0x80 is the same in both modes
+    for (const auto& Table : {PrimaryInstGroupOps_64, PrimaryInstGroupOps_32}) {
+      const auto& Info = Table[Group1Index(0x80, Reg)];
+      CHECK(strcmp(Info.Name, Group1Names[Reg]) == 0);
+      CHECK(Info.Type == TYPE_INST);
+      CHECK(Info.MoreBytes == 1);
+      CHECK(Info.OpcodeDispatcher != nullptr);
+    }
+
+    // 0x82 duplicates 0x80 in 32-bit mode and is invalid in 64-bit mode
+    CHECK(PrimaryInstGroupOps_64[Group1Index(0x82, Reg)].Type == TYPE_INVALID);
+
+    const auto& Info = PrimaryInstGroupOps_32[Group1Index(0x82, Reg)];
+    CHECK(strcmp(Info.Name, Group1Names[Reg]) == 0);
+    CHECK(Info.Type == TYPE_INST);
+    CHECK(Info.MoreBytes == 1);
+    CHECK(Info.Flags == PrimaryInstGroupOps_32[Group1Index(0x80, Reg)].Flags);
+  }
+
+  CHECK(PrimaryInstGroupOps_64[Group1Index(0x80, 0)].OpcodeDispatcher == &OpDispatchBuilder::SecondaryALUOp);
+  CHECK(PrimaryInstGroupOps_32[Group1Index(0x80, 0)].OpcodeDispatcher == &OpDispatchBuilder::SecondaryALUOp);
+}
+
+TEST_CASE("X86Tables - X87Ops") {
+  // Both precisions decode the same instructions, only the handlers differ.
+  for (size_t i = 0; i < MAX_X87_TABLE_SIZE; ++i) {
+    const auto& F80 = X87Ops_F80[i];
+    const auto& F64 = X87Ops_F64[i];
+    INFO("Index 0x" << std::hex << i << ": " << (F80.Name ?: "<null>"));
+
+    if (F80.Name && F64.Name) {
+      CHECK(strcmp(F80.Name, F64.Name) == 0);
+    } else {
+      CHECK(F80.Name == F64.Name);
+    }
+    CHECK(F80.Type == F64.Type);
+    CHECK(F80.Flags == F64.Flags);
+    CHECK((F80.OpcodeDispatcher == nullptr) == (F64.OpcodeDispatcher == nullptr));
+  }
+
+  // D8 /0 is FADD m32
+  REQUIRE(strcmp(X87Ops_F80[0].Name, "FADD") == 0);
+  REQUIRE(X87Ops_F80[0].OpcodeDispatcher != nullptr);
+  REQUIRE(X87Ops_F64[0].OpcodeDispatcher != nullptr);
+  REQUIRE(X87Ops_F80[0].OpcodeDispatcher != X87Ops_F64[0].OpcodeDispatcher);
+}
@@ -149,6 +149,11 @@ if ResultCode == 0:
         if (expected_output[test_name] == ResultCode):
             break
 
+if (ResultCode == 125 and expected_output[test_name] != ResultCode):
+    # The test itself reported that it was skipped
+    print("test skipped")
+    sys.exit(125)
+
 if (expected_output[test_name] != ResultCode):
     if (test_name in expected_output):
         print("test failed, expected is", expected_output[test_name], "but got", ResultCode)
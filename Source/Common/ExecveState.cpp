@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: MIT
+#include "Common/ExecveState.h"
+#include "Common/FEXServerClient.h"
+
+#include "git_version.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <span>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FEX::ExecveState {
+namespace {
+  static_assert(sizeof(GIT_DESCRIBE_STRING) <= sizeof(Header::FEXVersion), "FEX version doesn't fit");
+
+  fextl::vector<uint32_t> HostCPUMIDRs;
+  std::optional<State> Inherited;
+
+  void CloseFDs(const Header& StateHeader) {
+    if (StateHeader.ServerFD != -1) {
+      close(StateHeader.ServerFD);
+    }
+    if (StateHeader.RootFSFD != -1) {
+      close(StateHeader.RootFSFD);
+    }
+  }
+
+  bool ReadHeader(int FD, Header* StateHeader) {
+    return pread(FD, StateHeader, sizeof(Header), 0) == sizeof(Header) && StateHeader->Magic == MAGIC;
+  }
+
+  // ServerFD and RootFSFD get duplicated without FD_CLOEXEC if they are valid.
+  // A shared state stays in FEXServer for every new client, so it is FD_CLOEXEC.
+  int Write(int ServerFD, const std::optional<fextl::string>& ServerRootFSPath, int RootFSFD, const fextl::string& RootFSPath, bool Shared) {
+    const size_t ServerRootFSPathLength = ServerRootFSPath ? ServerRootFSPath->size() : 0;
+    const auto ServerSocketName = FEXServerClient::GetServerSocketName();
+    if (ServerRootFSPathLength > std::numeric_limits<uint32_t>::max() || ServerSocketName.size() > std::numeric_limits<uint32_t>::max() ||
+        RootFSPath.size() > std::numeric_limits<uint32_t>::max()) {
+      return -1;
+    }
+
+    fextl::vector<char> Data(sizeof(Header));
+    if (ServerRootFSPath) {
+      Data.insert(Data.end(), ServerRootFSPath->begin(), ServerRootFSPath->end());
+    }
+    Data.insert(Data.end(), ServerSocketName.begin(), ServerSocketName.end());
+    Data.insert(Data.end(), RootFSPath.begin(), RootFSPath.end());
+    const auto MIDRs = std::span<const char>(reinterpret_cast<const char*>(HostCPUMIDRs.data()), HostCPUMIDRs.size() * sizeof(uint32_t));
+    Data.insert(Data.end(), MIDRs.begin(), MIDRs.end());
+
+    int FD = memfd_create("FEXExecveState", MFD_ALLOW_SEALING | (Shared ? MFD_CLOEXEC : 0));
+    if (FD == -1) {
+      return -1;
+    }
+
+    // dup doesn't carry FD_CLOEXEC over.
+    Header StateHeader {
+      .Magic = MAGIC,
+      .Version = VERSION,
+      .ServerFD = ServerFD >= 0 ? dup(ServerFD) : -1,
+      .RootFSFD = RootFSFD >= 0 && !RootFSPath.empty() ? dup(RootFSFD) : -1,
+      .FEXVersion = GIT_DESCRIBE_STRING,
+      .Size = Data.size(),
+      .HasServerRootFSPath = ServerRootFSPath.has_value(),
+      .ServerRootFSPathLength = static_cast<uint32_t>(ServerRootFSPathLength),
+      .RootFSPathLength = static_cast<uint32_t>(RootFSPath.size()),
+      .NumCPUMIDRs = static_cast<uint32_t>(HostCPUMIDRs.size()),
+      .ServerEUID = ::geteuid(),
+      .ServerSocketNameLength = static_cast<uint32_t>(ServerSocketName.size()),
+      .Pad = {},
+    };
+    memcpy(Data.data(), &StateHeader, sizeof(StateHeader));
+
+    size_t Written {};
+    while (Written < Data.size()) {
+      ssize_t Res = write(FD, &Data[Written], Data.size() - Written);
+      if (Res == -1 && errno == EINTR) {
+        continue;
+      }
+      if (Res <= 0) {
+        CloseFDs(StateHeader);
+        close(FD);
+        return -1;
+      }
+      Written += Res;
+    }
+
+    // The server shares one state between all of its clients, none of them may change it.
+    if (fcntl(FD, F_ADD_SEALS, F_SEAL_SEAL | F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE) == -1) {
+      CloseFDs(StateHeader);
+      close(FD);
+      return -1;
+    }
+
+    return FD;
+  }
+} // namespace
+
+void SetCPUMIDRs(const fextl::vector<uint32_t>& CPUMIDRs) {
+  HostCPUMIDRs = CPUMIDRs;
+}
+
+int Serialize(int RootFSFD, const fextl::string& RootFSPath) {
+  return Write(FEXServerClient::GetServerFD(), FEXServerClient::GetServerRootFSPath(), RootFSFD, RootFSPath, false);
+}
+
+int SerializeStartupState(const fextl::string& ServerRootFSPath) {
+  return Write(-1, ServerRootFSPath, -1, {}, true);
+}
+
+void Discard(int FD) {
+  Header StateHeader {};
+  if (ReadHeader(FD, &StateHeader)) {
+    CloseFDs(StateHeader);
+  }
+  close(FD);
+}
+
+bool LoadInherited(int FD) {
+  Header StateHeader {};
+  if (!ReadHeader(FD, &StateHeader)) {
+    close(FD);
+    return false;
+  }
+
+  struct stat Buffer {};
+  if (StateHeader.Version != VERSION || strncmp(StateHeader.FEXVersion, GIT_DESCRIBE_STRING, sizeof(StateHeader.FEXVersion)) != 0 ||
+      fstat(FD, &Buffer) != 0 || StateHeader.Size != static_cast<uint64_t>(Buffer.st_size)) {
+    Discard(FD);
+    return false;
+  }
+
+  void* Ptr = mmap(nullptr, StateHeader.Size, PROT_READ, MAP_PRIVATE, FD, 0);
+  if (Ptr == MAP_FAILED) {
+    Discard(FD);
+    return false;
+  }
+
+  auto Data = std::span<const char>(reinterpret_cast<const char*>(Ptr), StateHeader.Size).subspan(sizeof(Header));
+  const uint64_t FixedSize = uint64_t {StateHeader.ServerRootFSPathLength} + StateHeader.ServerSocketNameLength + StateHeader.RootFSPathLength +
+                             uint64_t {StateHeader.NumCPUMIDRs} * sizeof(uint32_t);
+
+  bool Valid = FixedSize == Data.size();
+  State Loaded {};
+  if (Valid) {
+    if (StateHeader.HasServerRootFSPath) {
+      Loaded.ServerRootFSPath = fextl::string(Data.data(), StateHeader.ServerRootFSPathLength);
+    }
+    Data = Data.subspan(StateHeader.ServerRootFSPathLength);
+
+    Loaded.ServerEUID = StateHeader.ServerEUID;
+    Loaded.ServerSocketName = fextl::string(Data.data(), StateHeader.ServerSocketNameLength);
+    Data = Data.subspan(StateHeader.ServerSocketNameLength);
+
+    Loaded.RootFSPath = fextl::string(Data.data(), StateHeader.RootFSPathLength);
+    Data = Data.subspan(StateHeader.RootFSPathLength);
+
+    Loaded.CPUMIDRs.resize(StateHeader.NumCPUMIDRs);
+    memcpy(Loaded.CPUMIDRs.data(), Data.data(), StateHeader.NumCPUMIDRs * sizeof(uint32_t));
+  }
+
+  munmap(Ptr, StateHeader.Size);
+
+  if (!Valid) {
+    Discard(FD);
+    return false;
+  }
+
+  close(FD);
+  Loaded.ServerFD = StateHeader.ServerFD;
+  Loaded.RootFSFD = StateHeader.RootFSFD;
+  Inherited = std::move(Loaded);
+  return true;
+}
+
+std::optional<State>& GetInherited() {
+  return Inherited;
+}
+
+void CloseInherited() {
+  if (!Inherited) {
+    return;
+  }
+
+  if (Inherited->ServerFD != -1) {
+    close(Inherited->ServerFD);
+  }
+  if (Inherited->RootFSFD != -1) {
+    close(Inherited->RootFSFD);
+  }
+  Inherited.reset();
+}
+} // namespace FEX::ExecveState
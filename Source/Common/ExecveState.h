@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/fextl/string.h>
+#include <FEXCore/fextl/vector.h>
+
+#include <cstdint>
+#include <optional>
+
+/**
+ * @brief State handed from one FEX process image to the next across a guest execve.
+ *
+ * The execve handler writes the parts of startup that don't depend on the new program in to a sealed memfd and passes it
+ * through the `FEX_EXECVESTATEFD` environment variable, like `FEX_EXECVEFD` and `FEX_SECCOMPFD`.
+ * The new image then skips connecting to FEXServer, asking it for the rootfs, opening the rootfs and reading CPU MIDRs
+ * from sysfs.
+ *
+ * FEXServer also prepares one state without FDs for processes that weren't started by a FEX execve.
+ *
+ * Layout: Header, the server's rootfs path, the server's socket name, the rootfs path, then the CPU MIDRs.
+ */
+namespace FEX::ExecveState {
+constexpr uint32_t MAGIC = 0x53455846; // 'FXES'
+constexpr uint32_t VERSION = 3;
+
+struct Header {
+  uint32_t Magic;
+  uint32_t Version;
+  // FDs duplicated in to the new process image, -1 if not passed.
+  // These stay directly after Version so that a mismatched FEX version can still close them.
+  int32_t ServerFD;
+  int32_t RootFSFD;
+  char FEXVersion[64];
+  uint64_t Size;
+  uint32_t HasServerRootFSPath;
+  uint32_t ServerRootFSPathLength;
+  uint32_t RootFSPathLength;
+  uint32_t NumCPUMIDRs;
+  // Who ServerFD is connected as, see FEXServerClient::GetServerSocketName.
+  uint32_t ServerEUID;
+  uint32_t ServerSocketNameLength;
+  uint32_t Pad;
+};
+
+struct State {
+  // Socket to FEXServer and the rootfs path it gave out, see FEXServerClient::SetupInheritedClient.
+  int ServerFD {-1};
+  std::optional<fextl::string> ServerRootFSPath;
+  uint32_t ServerEUID {};
+  fextl::string ServerSocketName;
+  // O_PATH FD of the rootfs folder, only usable if the new image ends up with the same RootFSPath.
+  int RootFSFD {-1};
+  fextl::string RootFSPath;
+  fextl::vector<uint32_t> CPUMIDRs;
+};
+
+/**
+ * @brief Records the host's CPU MIDRs so they can be handed over.
+ */
+void SetCPUMIDRs(const fextl::vector<uint32_t>& CPUMIDRs);
+
+/**
+ * @brief Writes this process's state in to a sealed memfd for the next process image.
+ *
+ * The FEXServer socket and rootfs FD get duplicated without FD_CLOEXEC so they survive execve.
+ * Only hand the state to an execve that ends up in this FEX binary, anything else leaks the FDs.
+ *
+ * @param RootFSFD - O_PATH FD of the rootfs folder, ignored if negative
+ * @param RootFSPath - Folder RootFSFD was opened from
+ *
+ * @return The memfd, also without FD_CLOEXEC, or -1 on failure. Pass it to Discard if execve fails.
+ */
+int Serialize(int RootFSFD, const fextl::string& RootFSPath);
+
+/**
+ * @brief Writes the startup state FEXServer hands to new clients, see FEXServerClient::RequestStartupStateFD.
+ *
+ * Carries no FDs, so one state can be shared between every client.
+ *
+ * @param ServerRootFSPath - The rootfs path the server hands out
+ *
+ * @return The memfd or -1 on failure
+ */
+int SerializeStartupState(const fextl::string& ServerRootFSPath);
+
+/**
+ * @brief Closes a memfd from Serialize along with the FDs it carries.
+ */
+void Discard(int FD);
+
+/**
+ * @brief Reads the state handed over by the previous process image or FEXServer.
+ *
+ * Takes ownership of FD. A state from a different FEX version is discarded.
+ *
+ * @return true if the state was loaded
+ */
+bool LoadInherited(int FD);
+
+/**
+ * @brief The state from LoadInherited, if any.
+ *
+ * Whoever takes ownership of one of its FDs sets it to -1.
+ */
+std::optional<State>& GetInherited();
+
+/**
+ * @brief Closes the inherited FDs nobody took ownership of.
+ */
+void CloseInherited();
+} // namespace FEX::ExecveState
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 #include "Common/Config.h"
+#include "Common/ExecveState.h"
 #include "Common/FEXServerClient.h"
 
 #include <FEXCore/Utils/CompilerDefs.h>
@@ -12,6 +13,7 @@
 
 #include <fcntl.h>
 #include <linux/limits.h>
+#include <optional>
 #include <unistd.h>
 #include <sys/poll.h>
 #include <sys/prctl.h>
@@ -82,17 +84,18 @@ int RequestPIDFDPacket(int ServerSocket, PacketType Type) {
 }
 
 static int ServerFD {-1};
+static std::optional<fextl::string> ServerRootFSPath;
 
 fextl::string GetServerLockFolder() {
   return FEXCore::Config::GetDataDirectory() + "Server/";
 }
 
 fextl::string GetServerLockFile() {
-  return GetServerLockFolder() + "Server.lock";
+  return fextl::fmt::format("{}Server.{}.lock", GetServerLockFolder(), PROTOCOL_VERSION);
 }
 
 fextl::string GetServerRootFSLockFile() {
-  return GetServerLockFolder() + "RootFS.lock";
+  return fextl::fmt::format("{}RootFS.{}.lock", GetServerLockFolder(), PROTOCOL_VERSION);
 }
 
 fextl::string GetTempFolder() {
@@ -136,11 +139,12 @@ fextl::string GetServerMountFolder() {
 }
 
 fextl::string GetServerSocketName() {
+  // Servers of another protocol version listen on a different socket, so they never see requests they don't know.
   FEX_CONFIG_OPT(ServerSocketPath, SERVERSOCKETPATH);
   if (ServerSocketPath().empty()) {
-    return fextl::fmt::format("{}.FEXServer.Socket", ::geteuid());
+    return fextl::fmt::format("{}.FEXServer.{}.Socket", ::geteuid(), PROTOCOL_VERSION);
   }
-  return ServerSocketPath;
+  return fextl::fmt::format("{}.{}", ServerSocketPath(), PROTOCOL_VERSION);
 }
 
 int GetServerFD() {
@@ -188,15 +192,47 @@ bool SetupClient(char* InterpreterPath) {
   // If we were started in a container then we want to use the rootfs that they provided.
   // In the pressure-vessel case this is a combination of our rootfs and the steam soldier runtime.
   if (FEXCore::Config::FindContainer() != "pressure-vessel") {
-    fextl::string RootFSPath = FEXServerClient::RequestRootFSPath(ServerFD);
+    // The startup state carries the rootfs path along with what the server already read about the host.
+    // Fall back to asking for the path if the server is from a different FEX version.
+    // A state inherited over execve already covers the host, don't replace it.
+    auto& Inherited = FEX::ExecveState::GetInherited();
+    int StateFD = Inherited ? -1 : FEXServerClient::RequestStartupStateFD(ServerFD);
+    if (StateFD != -1 && FEX::ExecveState::LoadInherited(StateFD) && Inherited->ServerRootFSPath) {
+      ServerRootFSPath = Inherited->ServerRootFSPath;
+    } else {
+      ServerRootFSPath = FEXServerClient::RequestRootFSPath(ServerFD);
+    }
 
     //// If everything has passed then we can now update the rootfs path
-    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_ROOTFS, RootFSPath);
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_ROOTFS, *ServerRootFSPath);
   }
 
   return true;
 }
 
+bool SetupInheritedClient(int InheritedServerFD, std::optional<fextl::string> InheritedRootFSPath, uint32_t ServerEUID,
+                          const fextl::string& ServerSocketName) {
+  // The execve may have changed the effective user or FEX_SERVERSOCKETPATH, which means a different server.
+  if (ServerEUID != ::geteuid() || ServerSocketName != GetServerSocketName()) {
+    close(InheritedServerFD);
+    return false;
+  }
+
+  ServerFD = InheritedServerFD;
+  fcntl(ServerFD, F_SETFD, FD_CLOEXEC);
+
+  ServerRootFSPath = std::move(InheritedRootFSPath);
+  if (ServerRootFSPath) {
+    FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_ROOTFS, *ServerRootFSPath);
+  }
+
+  return true;
+}
+
+const std::optional<fextl::string>& GetServerRootFSPath() {
+  return ServerRootFSPath;
+}
+
 int ConnectToAndStartServer(char* InterpreterPath) {
   int ServerFD = ConnectToServer(ConnectionOption::NoPrintConnectionError);
   if (ServerFD == -1) {
@@ -329,6 +365,14 @@ int RequestPIDFD(int ServerSocket) {
   return RequestPIDFDPacket(ServerSocket, PacketType::TYPE_GET_PID_FD);
 }
 
+int RequestRootFSIndexFD(int ServerSocket) {
+  return RequestPIDFDPacket(ServerSocket, PacketType::TYPE_GET_ROOTFS_INDEX_FD);
+}
+
+int RequestStartupStateFD(int ServerSocket) {
+  return RequestPIDFDPacket(ServerSocket, PacketType::TYPE_GET_STARTUP_STATE_FD);
+}
+
 /**  @} */
 
 /**
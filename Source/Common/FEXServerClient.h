@@ -5,7 +5,13 @@
 #include <FEXCore/fextl/string.h>
 #include <FEXHeaderUtils/Syscalls.h>
 
+#include <optional>
+
 namespace FEXServerClient {
+// Part of the socket and lock file names, so clients only ever talk to a server that knows all of their requests.
+// Bump it when adding a packet type.
+constexpr uint32_t PROTOCOL_VERSION = 1;
+
 enum class PacketType {
   // Request and Result
   TYPE_KILL,
@@ -16,6 +22,11 @@ enum class PacketType {
   // Result only
   TYPE_SUCCESS,
   TYPE_ERROR,
+
+  // Request and Result
+  // Newer requests go last so the values above stay the same for FEXServers from older FEX versions.
+  TYPE_GET_ROOTFS_INDEX_FD,
+  TYPE_GET_STARTUP_STATE_FD,
 };
 
 union FEXServerRequestPacket {
@@ -57,6 +68,26 @@ int GetServerFD();
 
 bool SetupClient(char* InterpreterPath);
 
+/**
+ * @brief Sets up the client with the server connection of the process image that execve'd us
+ *
+ * Skips connecting and asking for the rootfs path again.
+ *
+ * @param InheritedServerFD - Socket to the server, takes ownership
+ * @param InheritedRootFSPath - Rootfs path the server gave the previous process image, if it asked
+ * @param ServerEUID - Effective user the previous process image connected as
+ * @param ServerSocketName - Socket name the previous process image connected to
+ *
+ * @return false if this process would connect to a different server, InheritedServerFD is closed in that case
+ */
+bool SetupInheritedClient(int InheritedServerFD, std::optional<fextl::string> InheritedRootFSPath, uint32_t ServerEUID,
+                          const fextl::string& ServerSocketName);
+
+/**
+ * @brief The rootfs path the server gave us during setup, if it was asked for
+ */
+const std::optional<fextl::string>& GetServerRootFSPath();
+
 /**
  * @brief Connect to and start a FEXServer instance if required
  *
@@ -105,6 +136,24 @@ fextl::string RequestRootFSPath(int ServerSocket);
  */
 int RequestPIDFD(int ServerSocket);
 
+/**
+ * @brief Request a FEXServer to give us the index of the rootfs image it has mounted
+ *
+ * @param ServerSocket - Socket to the server
+ *
+ * @return Sealed memfd of the index, or -1 if the server doesn't have one
+ */
+int RequestRootFSIndexFD(int ServerSocket);
+
+/**
+ * @brief Request a FEXServer to give us the startup state it prepared for new clients
+ *
+ * @param ServerSocket - Socket to the server
+ *
+ * @return Sealed memfd in the FEX::ExecveState format, or -1 if the server couldn't create one
+ */
+int RequestStartupStateFD(int ServerSocket);
+
 /**  @} */
 
 /**
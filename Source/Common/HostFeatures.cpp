@@ -486,6 +486,7 @@ FEXCore::HostFeatures FetchHostFeatures(FEX::CPUFeatures& Features, bool Support
   HostFeatures.SupportsFlagM2 = Features.Supports(CPUFeatures::Feature::FlagM2);
   HostFeatures.SupportsRPRES = Features.Supports(CPUFeatures::Feature::RPRES);
   HostFeatures.SupportsSVEBitPerm = Features.Supports(CPUFeatures::Feature::SVE_BitPerm);
+  HostFeatures.SupportsWFXT = Features.Supports(CPUFeatures::Feature::WFxt);
 
 #ifdef VIXL_SIMULATOR
   // Hardcode enable SVE with 256-bit wide registers.
@@ -604,10 +605,14 @@ FEXCore::HostFeatures FetchHostFeatures(FEX::CPUFeatures& Features, bool Support
   }
 
   OverrideFeatures(&HostFeatures, ForceSVEWidth());
+
+  ///< Native 256-bit AVX lowering needs a SVE vector length that can hold a full YMM register.
+  ///< Derived after the overrides, so disableavx and FORCESVEWIDTH select the lowering as well.
+  HostFeatures.SupportsAVX256 = HostFeatures.SupportsAVX && HostFeatures.SupportsSVE256;
   return HostFeatures;
 }
 
-FEXCore::HostFeatures FetchHostFeatures() {
+FEXCore::HostFeatures FetchHostFeatures(std::span<const uint32_t> InheritedCPUMIDRs) {
 #ifdef _M_X86_64
   CPUFeatures Features = CPUFeaturesAll {};
 
@@ -615,6 +620,8 @@ FEXCore::HostFeatures FetchHostFeatures() {
   Features.RemoveFeature(CPUFeatures::Feature::AFP);
   // Vixl simulator doesn't support RPRES.
   Features.RemoveFeature(CPUFeatures::Feature::RPRES);
+  // Vixl simulator doesn't support WFxT.
+  Features.RemoveFeature(CPUFeatures::Feature::WFxt);
 #else
   CPUFeatures Features = GetCPUFeaturesFromIDRegisters();
 #endif
@@ -629,7 +636,11 @@ FEXCore::HostFeatures FetchHostFeatures() {
 #endif
 
   auto HostFeatures = FetchHostFeatures(Features, true, CTR, MIDR);
-  FillMIDRInformationViaLinux(&HostFeatures);
+  if (InheritedCPUMIDRs.empty()) {
+    FillMIDRInformationViaLinux(&HostFeatures);
+  } else {
+    HostFeatures.CPUMIDRs.assign(InheritedCPUMIDRs.begin(), InheritedCPUMIDRs.end());
+  }
   return HostFeatures;
 }
 } // namespace FEX
@@ -4,6 +4,7 @@
 #include <FEXCore/Utils/EnumUtils.h>
 
 #include <cstddef>
+#include <span>
 
 namespace FEX {
 class CPUFeatures {
@@ -626,5 +627,11 @@ protected:
 void FillMIDRInformationViaLinux(FEXCore::HostFeatures* Features);
 
 FEXCore::HostFeatures FetchHostFeatures(FEX::CPUFeatures& Features, bool SupportsCacheMaintenanceOps, uint64_t CTR, uint64_t MIDR);
-FEXCore::HostFeatures FetchHostFeatures();
+/**
+ * @brief Fetches the host's features
+ *
+ * @param InheritedCPUMIDRs - Per-CPU MIDRs handed over from the process image that execve'd us.
+ * Read from sysfs if empty.
+ */
+FEXCore::HostFeatures FetchHostFeatures(std::span<const uint32_t> InheritedCPUMIDRs = {});
 } // namespace FEX
@@ -0,0 +1,334 @@
+// SPDX-License-Identifier: MIT
+#include "Common/RootFSIndex.h"
+
+#include <FEXCore/Utils/LogManager.h>
+#include <FEXCore/fextl/vector.h>
+
+#include <algorithm>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FEX::RootFSIndex {
+namespace {
+  struct BuildEntry {
+    fextl::string Path;
+    fextl::string Target;
+    EntryType Type;
+  };
+
+  // Takes ownership of DirFD. Returns false if the directory couldn't be fully read.
+  // Prefix is a copy since Entries may reallocate while walking.
+  bool Walk(int DirFD, fextl::string Prefix, fextl::vector<BuildEntry>& Entries, const std::atomic<bool>& Cancel) {
+    DIR* Dir = fdopendir(DirFD);
+    if (!Dir) {
+      close(DirFD);
+      return false;
+    }
+
+    bool Complete = true;
+    errno = 0;
+    while (auto Dirent = readdir(Dir)) {
+      if (Cancel.load(std::memory_order_relaxed)) {
+        Complete = false;
+        break;
+      }
+
+      const char* Name = Dirent->d_name;
+      if (strcmp(Name, ".") == 0 || strcmp(Name, "..") == 0) {
+        continue;
+      }
+
+      fextl::string Path = Prefix.empty() ? fextl::string(Name) : Prefix + "/" + Name;
+
+      unsigned char Type = Dirent->d_type;
+      if (Type == DT_UNKNOWN) {
+        struct stat Buffer {};
+        if (fstatat(dirfd(Dir), Name, &Buffer, AT_SYMLINK_NOFOLLOW) != 0) {
+          // A missing entry would turn in to a wrong ENOENT for clients.
+          Complete = false;
+          break;
+        }
+        Type = IFTODT(Buffer.st_mode);
+      }
+
+      if (Type == DT_DIR) {
+        const size_t Index = Entries.size();
+        Entries.emplace_back(BuildEntry {std::move(Path), {}, EntryType::Directory});
+
+        int SubFD = openat(dirfd(Dir), Name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+        if (SubFD == -1 || !Walk(SubFD, Entries[Index].Path, Entries, Cancel)) {
+          Entries[Index].Type = EntryType::Opaque;
+        }
+      } else if (Type == DT_LNK) {
+        char Target[PATH_MAX];
+        ssize_t TargetSize = readlinkat(dirfd(Dir), Name, Target, sizeof(Target));
+        if (TargetSize <= 0 || TargetSize == sizeof(Target)) {
+          Complete = false;
+          break;
+        }
+        Entries.emplace_back(BuildEntry {std::move(Path), fextl::string(Target, TargetSize), EntryType::Symlink});
+      } else {
+        Entries.emplace_back(BuildEntry {std::move(Path), {}, EntryType::File});
+      }
+
+      errno = 0;
+    }
+
+    if (errno != 0) {
+      Complete = false;
+    }
+
+    closedir(Dir);
+    return Complete;
+  }
+} // namespace
+
+int Build(const fextl::string& RootFS, const std::atomic<bool>& Cancel) {
+  if (RootFS.size() >= PATH_MAX) {
+    return -1;
+  }
+
+  int RootFD = open(RootFS.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (RootFD == -1) {
+    return -1;
+  }
+
+  fextl::vector<BuildEntry> Entries;
+  if (!Walk(RootFD, {}, Entries, Cancel) || Cancel.load(std::memory_order_relaxed)) {
+    return -1;
+  }
+
+  std::sort(Entries.begin(), Entries.end(), [](const BuildEntry& lhs, const BuildEntry& rhs) { return lhs.Path < rhs.Path; });
+
+  size_t StringsSize {};
+  for (const auto& Entry : Entries) {
+    StringsSize += Entry.Path.size() + Entry.Target.size();
+  }
+
+  if (StringsSize > std::numeric_limits<uint32_t>::max()) {
+    return -1;
+  }
+
+  Header IndexHeader {
+    .Magic = MAGIC,
+    .Version = VERSION,
+    .NumEntries = Entries.size(),
+    .EntriesOffset = sizeof(Header),
+    .StringsOffset = sizeof(Header) + Entries.size() * sizeof(Entry),
+    .Size = sizeof(Header) + Entries.size() * sizeof(Entry) + StringsSize,
+    .RootFS = {},
+  };
+  memcpy(IndexHeader.RootFS, RootFS.c_str(), RootFS.size() + 1);
+
+  fextl::vector<char> Data(IndexHeader.Size);
+  memcpy(Data.data(), &IndexHeader, sizeof(IndexHeader));
+
+  auto IndexEntries = reinterpret_cast<Entry*>(&Data[IndexHeader.EntriesOffset]);
+  char* Strings = &Data[IndexHeader.StringsOffset];
+  uint32_t StringOffset {};
+  for (size_t i = 0; i < Entries.size(); ++i) {
+    const auto& Entry = Entries[i];
+    IndexEntries[i] = {
+      .PathOffset = StringOffset,
+      .PathLength = static_cast<uint32_t>(Entry.Path.size()),
+      .TargetOffset = static_cast<uint32_t>(StringOffset + Entry.Path.size()),
+      .TargetLength = static_cast<uint32_t>(Entry.Target.size()),
+      .Type = Entry.Type,
+      .Pad = {},
+    };
+
+    memcpy(&Strings[StringOffset], Entry.Path.data(), Entry.Path.size());
+    StringOffset += Entry.Path.size();
+    memcpy(&Strings[StringOffset], Entry.Target.data(), Entry.Target.size());
+    StringOffset += Entry.Target.size();
+  }
+
+  int FD = memfd_create("FEXRootFSIndex", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (FD == -1) {
+    LogMan::Msg::EFmt("[FEXServer] Couldn't create rootfs index FD");
+    return -1;
+  }
+
+  size_t Written {};
+  while (Written < Data.size()) {
+    ssize_t Res = write(FD, &Data[Written], Data.size() - Written);
+    if (Res == -1 && errno == EINTR) {
+      continue;
+    }
+    if (Res <= 0) {
+      LogMan::Msg::EFmt("[FEXServer] Couldn't write rootfs index");
+      close(FD);
+      return -1;
+    }
+    Written += Res;
+  }
+
+  // Seal everything about this FD. Clients rely on the index never changing underneath them.
+  if (fcntl(FD, F_ADD_SEALS, F_SEAL_SEAL | F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE) == -1) {
+    close(FD);
+    return -1;
+  }
+
+  return FD;
+}
+
+Reader::~Reader() {
+  if (Base) {
+    munmap(Base, Size);
+  }
+}
+
+bool Reader::Load(int FD, std::string_view RootFS) {
+  // Only trust an index that nobody can modify any more.
+  constexpr int RequiredSeals = F_SEAL_SHRINK | F_SEAL_WRITE;
+  int Seals = fcntl(FD, F_GET_SEALS);
+  if (Seals == -1 || (Seals & RequiredSeals) != RequiredSeals) {
+    return false;
+  }
+
+  struct stat Buffer {};
+  if (fstat(FD, &Buffer) != 0 || Buffer.st_size < static_cast<off_t>(sizeof(Header))) {
+    return false;
+  }
+
+  void* Ptr = mmap(nullptr, Buffer.st_size, PROT_READ, MAP_SHARED, FD, 0);
+  if (Ptr == MAP_FAILED) {
+    return false;
+  }
+
+  const auto IndexHeader = reinterpret_cast<const Header*>(Ptr);
+  const bool Valid = IndexHeader->Magic == MAGIC && IndexHeader->Version == VERSION && IndexHeader->Size == static_cast<uint64_t>(Buffer.st_size) &&
+                     IndexHeader->EntriesOffset == sizeof(Header) &&
+                     IndexHeader->NumEntries <= (IndexHeader->Size - IndexHeader->EntriesOffset) / sizeof(Entry) &&
+                     IndexHeader->StringsOffset == IndexHeader->EntriesOffset + IndexHeader->NumEntries * sizeof(Entry) &&
+                     strnlen(IndexHeader->RootFS, PATH_MAX) < PATH_MAX && RootFS == IndexHeader->RootFS;
+
+  if (!Valid) {
+    munmap(Ptr, Buffer.st_size);
+    return false;
+  }
+
+  Base = Ptr;
+  Size = Buffer.st_size;
+  Entries = reinterpret_cast<const Entry*>(reinterpret_cast<const char*>(Ptr) + IndexHeader->EntriesOffset);
+  NumEntries = IndexHeader->NumEntries;
+  Strings = reinterpret_cast<const char*>(Ptr) + IndexHeader->StringsOffset;
+  return true;
+}
+
+const Entry* Reader::Find(std::string_view Path) const {
+  auto End = Entries + NumEntries;
+  auto It = std::lower_bound(Entries, End, Path,
+                             [this](const Entry& lhs, std::string_view rhs) { return GetString(lhs.PathOffset, lhs.PathLength) < rhs; });
+
+  if (It == End || GetString(It->PathOffset, It->PathLength) != Path) {
+    return nullptr;
+  }
+  return It;
+}
+
+LookupEntry Reader::Lookup(std::string_view Path) const {
+  constexpr LookupEntry Unknown {.Result = LookupResult::Unknown};
+  constexpr LookupEntry NotFound {.Result = LookupResult::NotFound};
+
+  if (!IsLoaded() || Path.empty() || Path[0] != '/' || Path.size() >= PATH_MAX) {
+    return Unknown;
+  }
+
+  // Rootfs relative path walked so far. Every component of it is a real directory.
+  char Resolved[PATH_MAX];
+  size_t ResolvedLength {};
+
+  // Holds the rest of the path once a relative symlink target has been spliced in.
+  char Pending[PATH_MAX];
+  std::string_view Remaining = Path.substr(1);
+  uint32_t Hops {};
+
+  for (;;) {
+    const size_t Slash = Remaining.find('/');
+    const bool Last = Slash == std::string_view::npos;
+    const auto Component = Remaining.substr(0, Slash);
+    const auto Rest = Last ? std::string_view {} : Remaining.substr(Slash + 1);
+
+    if (Component.empty() || Component == ".") {
+      if (Last) {
+        // Trailing slashes and dots need the kernel's directory checks.
+        return Unknown;
+      }
+      Remaining = Rest;
+      continue;
+    }
+
+    if (Component == "..") {
+      if (Last || ResolvedLength == 0) {
+        // Walking above the rootfs FD leaves the rootfs.
+        return Unknown;
+      }
+      const size_t Parent = std::string_view(Resolved, ResolvedLength).rfind('/');
+      ResolvedLength = Parent == std::string_view::npos ? 0 : Parent;
+      Remaining = Rest;
+      continue;
+    }
+
+    const size_t ParentLength = ResolvedLength;
+    const size_t NewLength = ParentLength + (ParentLength ? 1 : 0) + Component.size();
+    if (NewLength >= PATH_MAX) {
+      return Unknown;
+    }
+
+    if (ParentLength) {
+      Resolved[ParentLength] = '/';
+    }
+    memcpy(&Resolved[NewLength - Component.size()], Component.data(), Component.size());
+
+    const Entry* Found = Find(std::string_view(Resolved, NewLength));
+    if (!Found) {
+      return NotFound;
+    }
+
+    if (Last) {
+      return {
+        .Result = LookupResult::Found,
+        .Type = Found->Type == EntryType::Opaque ? EntryType::Directory : Found->Type,
+        .Target = GetString(Found->TargetOffset, Found->TargetLength),
+      };
+    }
+
+    if (Found->Type == EntryType::Directory) {
+      ResolvedLength = NewLength;
+      Remaining = Rest;
+      continue;
+    }
+
+    if (Found->Type != EntryType::Symlink) {
+      // Either ENOTDIR or a directory we don't know the contents of.
+      return Unknown;
+    }
+
+    // Absolute symlinks in the middle of a path are resolved by the kernel against the host root, not the rootfs.
+    const auto Target = GetString(Found->TargetOffset, Found->TargetLength);
+    if (++Hops > MAX_SYMLINK_HOPS || Target.empty() || Target[0] == '/') {
+      return Unknown;
+    }
+
+    const size_t PendingLength = Target.size() + 1 + Rest.size();
+    if (PendingLength >= PATH_MAX) {
+      return Unknown;
+    }
+
+    // Rest may already live in Pending.
+    memmove(&Pending[Target.size() + 1], Rest.data(), Rest.size());
+    memcpy(Pending, Target.data(), Target.size());
+    Pending[Target.size()] = '/';
+    Remaining = std::string_view(Pending, PendingLength);
+
+    // Relative targets resolve from the directory holding the symlink.
+    ResolvedLength = ParentLength;
+  }
+}
+} // namespace FEX::RootFSIndex
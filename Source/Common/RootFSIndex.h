@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <FEXCore/fextl/string.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <linux/limits.h>
+#include <string_view>
+
+/**
+ * @brief A read-only index of every path in a rootfs image.
+ *
+ * FEXServer walks the mounted image once and writes the index in to a sealed memfd.
+ * Every client maps the same memfd and consults it before asking the kernel about a path, which saves
+ * a handful of FUSE round trips per lookup. Only useful for immutable rootfs images.
+ *
+ * Layout: Header, then a table of Entry sorted by path, then the string data.
+ */
+namespace FEX::RootFSIndex {
+constexpr uint32_t MAGIC = 0x49524658; // 'FXRI'
+constexpr uint32_t VERSION = 1;
+
+// Matches the kernel's MAXSYMLINKS.
+constexpr uint32_t MAX_SYMLINK_HOPS = 40;
+
+enum class EntryType : uint8_t {
+  Directory,
+  File,
+  Symlink,
+  // A directory that couldn't be read while building the index. Its contents are unknown.
+  Opaque,
+};
+
+struct Header {
+  uint32_t Magic;
+  uint32_t Version;
+  uint64_t NumEntries;
+  uint64_t EntriesOffset;
+  uint64_t StringsOffset;
+  uint64_t Size;
+  // Where the image was mounted when this index was built. Clients only use the index if their rootfs matches.
+  char RootFS[PATH_MAX];
+};
+
+struct Entry {
+  // Offsets are relative to Header::StringsOffset.
+  // Paths are relative to the rootfs, without the leading '/'.
+  uint32_t PathOffset;
+  uint32_t PathLength;
+  uint32_t TargetOffset;
+  uint32_t TargetLength;
+  EntryType Type;
+  uint8_t Pad[3];
+};
+static_assert(sizeof(Entry) == 20);
+
+/**
+ * @brief Walks a mounted rootfs and writes its index in to a sealed memfd.
+ *
+ * @param RootFS - Folder the rootfs is mounted at
+ * @param Cancel - Checked while walking, stops building early when set
+ *
+ * @return memfd of the index or -1 on failure
+ */
+int Build(const fextl::string& RootFS, const std::atomic<bool>& Cancel);
+
+enum class LookupResult {
+  // The path exists in the rootfs. Type and Target describe the final path component.
+  Found,
+  // The path doesn't exist in the rootfs.
+  NotFound,
+  // The index can't answer for this path. Ask the kernel.
+  Unknown,
+};
+
+struct LookupEntry {
+  LookupResult Result;
+  EntryType Type;
+  std::string_view Target;
+};
+
+class Reader final {
+public:
+  Reader() = default;
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+  ~Reader();
+
+  /**
+   * @brief Maps an index memfd.
+   *
+   * @param FD - memfd received from FEXServer, can be closed afterwards
+   * @param RootFS - Rootfs folder this process is using
+   *
+   * @return true if the index is valid and was built for RootFS
+   */
+  bool Load(int FD, std::string_view RootFS);
+
+  bool IsLoaded() const {
+    return Base != nullptr;
+  }
+
+  /**
+   * @brief Looks up an absolute guest path like `fstatat(RootFSFD, &Path[1], AT_SYMLINK_NOFOLLOW)` would.
+   *
+   * Intermediate relative symlinks are followed inside the index. Anything the index can't answer
+   * identically to the kernel (absolute intermediate symlinks, `..` escaping the rootfs, trailing slashes)
+   * returns Unknown.
+   */
+  LookupEntry Lookup(std::string_view Path) const;
+
+private:
+  const Entry* Find(std::string_view Path) const;
+  std::string_view GetString(uint32_t Offset, uint32_t Length) const {
+    return std::string_view(Strings + Offset, Length);
+  }
+
+  void* Base {};
+  size_t Size {};
+  const Entry* Entries {};
+  size_t NumEntries {};
+  const char* Strings {};
+};
+} // namespace FEX::RootFSIndex
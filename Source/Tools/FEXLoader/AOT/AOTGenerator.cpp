@@ -5,17 +5,49 @@
 #include <FEXCore/Core/Context.h>
 #include <FEXCore/Utils/CPUInfo.h>
 #include <FEXCore/Utils/LogManager.h>
-#include <FEXCore/fextl/queue.h>
+#include <FEXCore/fextl/deque.h>
 #include <FEXCore/fextl/set.h>
 #include <FEXCore/fextl/vector.h>
 #include <FEXHeaderUtils/Syscalls.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <mutex>
+#include <optional>
 #include <sys/resource.h>
 #include <sys/sysinfo.h>
 #include <thread>
 
 namespace FEX::AOT {
+namespace {
+  struct WorkQueue {
+    std::mutex Mutex;
+    fextl::deque<uint64_t> Targets;
+
+    std::optional<uint64_t> PopBack() {
+      std::scoped_lock lk {Mutex};
+      if (Targets.empty()) {
+        return std::nullopt;
+      }
+      auto Target = Targets.back();
+      Targets.pop_back();
+      return Target;
+    }
+
+    std::optional<uint64_t> PopFront() {
+      std::scoped_lock lk {Mutex};
+      if (Targets.empty()) {
+        return std::nullopt;
+      }
+      auto Target = Targets.front();
+      Targets.pop_front();
+      return Target;
+    }
+  };
+} // namespace
+
 void AOTGenSection(FEXCore::Context::Context* CTX, ELFCodeLoader::LoadedSection& Section) {
   // Make sure this section is executable and big enough
   if (!Section.Executable || Section.Size < 16) {
@@ -83,28 +115,42 @@ void AOTGenSection(FEXCore::Context::Context* CTX, ELFCodeLoader::LoadedSection&
 
   uint64_t SectionMaxAddress = Section.Base + Section.Size;
 
-  fextl::set<uint64_t> Compiled;
-  std::atomic<int> counter = 0;
+  const size_t NumWorkers = std::max(1, FEXCore::CPUInfo::CalculateNumberOfCPUs());
+
+  // Visited set, one bit per address in the section. Lets workers claim a branch target without taking a lock.
+  fextl::vector<std::atomic<uint64_t>> Visited((Section.Size + 1 + 63) / 64);
+  auto ClaimTarget = [&Visited, &Section](uint64_t Destination) {
+    const uint64_t Offset = Destination - Section.Base;
+    const uint64_t Bit = 1ULL << (Offset & 63);
+    return (Visited[Offset / 64].fetch_or(Bit, std::memory_order_relaxed) & Bit) == 0;
+  };
 
-  fextl::queue<uint64_t> BranchTargets;
+  // Each worker owns a deque. It pushes and pops at the back, so it keeps working on the code it just discovered,
+  // while idle workers steal from the front.
+  fextl::vector<WorkQueue> Queues(NumWorkers);
 
-  // Setup BranchTargets, Compiled sets from InitiaBranchTargets
+  // Entrypoints that are queued or being compiled. Workers only exit once this reaches zero,
+  // since any entrypoint being compiled can still discover more.
+  std::atomic<size_t> Outstanding {};
+  std::atomic<size_t> Counter {};
 
-  Compiled.insert(InitialBranchTargets.begin(), InitialBranchTargets.end());
+  // Setup the worker queues from InitialBranchTargets
+  size_t NextQueue {};
   for (auto BranchTarget : InitialBranchTargets) {
-    BranchTargets.push(BranchTarget);
+    ClaimTarget(BranchTarget);
+    Queues[NextQueue].Targets.push_back(BranchTarget);
+    NextQueue = (NextQueue + 1) % NumWorkers;
   }
+  Outstanding = InitialBranchTargets.size();
 
   InitialBranchTargets.clear();
 
-
-  std::mutex QueueMutex;
   fextl::vector<std::thread> ThreadPool;
 
   // This code is tricky to refactor so it doesn't allocate memory through glibc.
   FEXCore::Allocator::YesIKnowImNotSupposedToUseTheGlibcAllocator glibc;
-  for (int i = 0; i < FEXCore::CPUInfo::CalculateNumberOfCPUs(); i++) {
-    std::thread thd([&BranchTargets, CTX, &counter, &Compiled, &Section, &QueueMutex, SectionMaxAddress]() {
+  for (size_t i = 0; i < NumWorkers; i++) {
+    std::thread thd([&Queues, CTX, &Counter, &Outstanding, &ClaimTarget, &Section, SectionMaxAddress, i]() {
       // Set the priority of the thread so it doesn't overwhelm the system when running in the background
       setpriority(PRIO_PROCESS, FHU::Syscalls::gettid(), 19);
 
@@ -113,41 +159,49 @@ void AOTGenSection(FEXCore::Context::Context* CTX, ELFCodeLoader::LoadedSection&
       fextl::set<uint64_t> ExternalBranchesLocal;
       CTX->ConfigureAOTGen(Thread, &ExternalBranchesLocal, SectionMaxAddress);
 
-      for (;;) {
-        uint64_t BranchTarget;
+      auto& LocalQueue = Queues[i];
 
-        // Get a entrypoint to process from the queue
-        QueueMutex.lock();
-        if (BranchTargets.empty()) {
-          QueueMutex.unlock();
-          break; // no entrypoint to process - exit
+      for (;;) {
+        // Get a entrypoint to process, first from our own queue then from the others
+        auto BranchTarget = LocalQueue.PopBack();
+        for (size_t j = 1; !BranchTarget && j < Queues.size(); ++j) {
+          BranchTarget = Queues[(i + j) % Queues.size()].PopFront();
         }
 
-        BranchTarget = BranchTargets.front();
-        BranchTargets.pop();
-        QueueMutex.unlock();
+        if (!BranchTarget) {
+          if (Outstanding.load() == 0) {
+            break; // no entrypoint to process - exit
+          }
+
+          // Another worker is still compiling and may find more
+          std::this_thread::sleep_for(std::chrono::microseconds(100));
+          continue;
+        }
 
         // Compile entrypoint
-        counter++;
-        CTX->CompileRIP(Thread, BranchTarget);
+        Counter++;
+        CTX->CompileRIP(Thread, *BranchTarget);
 
         // Are there more branches?
         if (ExternalBranchesLocal.size() > 0) {
           // Add them to the "to process" list
-          QueueMutex.lock();
+          std::unique_lock lk {LocalQueue.Mutex};
           for (auto Destination : ExternalBranchesLocal) {
             if (!(Destination >= Section.Base && Destination <= (Section.Base + Section.Size))) {
               continue;
             }
-            if (Compiled.contains(Destination)) {
+            if (!ClaimTarget(Destination)) {
               continue;
             }
-            Compiled.insert(Destination);
-            BranchTargets.push(Destination);
+            Outstanding++;
+            LocalQueue.Targets.push_back(Destination);
           }
-          QueueMutex.unlock();
+          lk.unlock();
           ExternalBranchesLocal.clear();
         }
+
+        // Only retire this entrypoint after its branches are queued, so Outstanding can't hit zero early
+        Outstanding--;
       }
 
       // All entryproints processed, cleanup this thread
@@ -160,6 +214,23 @@ void AOTGenSection(FEXCore::Context::Context* CTX, ELFCodeLoader::LoadedSection&
     ThreadPool.push_back(std::move(thd));
   }
 
+  // Report progress while the workers are running
+  const auto Start = std::chrono::steady_clock::now();
+  auto LastReport = Start;
+  size_t LastCount {};
+  while (Outstanding.load() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const auto Now = std::chrono::steady_clock::now();
+    if (Now - LastReport >= std::chrono::seconds(1)) {
+      const size_t Count = Counter.load();
+      const double Seconds = std::chrono::duration<double>(Now - LastReport).count();
+      LogMan::Msg::IFmt("Compiled: {}, Remaining: {}, {:.0f} entrypoints/s", Count, Outstanding.load(), (Count - LastCount) / Seconds);
+      LastReport = Now;
+      LastCount = Count;
+    }
+  }
+
   // Make sure all threads are finished
   for (auto& Thread : ThreadPool) {
     Thread.join();
@@ -167,6 +238,7 @@ void AOTGenSection(FEXCore::Context::Context* CTX, ELFCodeLoader::LoadedSection&
 
   ThreadPool.clear();
 
-  LogMan::Msg::IFmt("\nAll Done: {}", counter.load());
+  const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+  LogMan::Msg::IFmt("\nAll Done: {} in {:.2f}s with {} threads", Counter.load(), Seconds, NumWorkers);
 }
 } // namespace FEX::AOT
@@ -8,6 +8,7 @@ $end_info$
 
 #include "AOT/AOTGenerator.h"
 #include "Common/ArgumentLoader.h"
+#include "Common/ExecveState.h"
 #include "Common/FEXServerClient.h"
 #include "Common/Config.h"
 #include "Common/HostFeatures.h"
@@ -39,6 +40,7 @@ $end_info$
 #include <FEXCore/fextl/vector.h>
 #include <FEXHeaderUtils/Filesystem.h>
 
+#include <array>
 #include <atomic>
 #include <cerrno>
 #include <cstdint>
@@ -56,6 +58,7 @@ $end_info$
 #include <sys/select.h>
 #include <system_error>
 #include <thread>
+#include <time.h>
 #include <unistd.h>
 #include <utility>
 
@@ -287,6 +290,51 @@ void SetupTSOEmulation(FEXCore::Context::Context* CTX) {
 }
 } // namespace FEX::TSO
 
+namespace FEX::StartupTrace {
+// Timestamps are always taken since they are cheap, the config that decides whether to print them isn't loaded yet at the start.
+struct Phase {
+  const char* Name;
+  uint64_t Time;
+};
+
+constexpr size_t MAX_PHASES = 16;
+static std::array<Phase, MAX_PHASES> Phases;
+static size_t NumPhases {};
+static uint64_t StartTime {};
+
+static uint64_t Now() {
+  struct timespec ts {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1'000'000'000ULL + ts.tv_nsec;
+}
+
+static void Begin() {
+  StartTime = Now();
+}
+
+///< Marks the end of the phase named Name.
+static void Mark(const char* Name) {
+  if (NumPhases < Phases.size()) {
+    Phases[NumPhases++] = {Name, Now()};
+  }
+}
+
+static void Report(std::string_view ProgramName) {
+  FEX_CONFIG_OPT(PrintStartupTrace, STARTUPTRACE);
+  if (!PrintStartupTrace()) {
+    return;
+  }
+
+  fextl::fmt::print(stderr, "[{}][{}] Startup trace\n", ::getpid(), ProgramName);
+  uint64_t Previous = StartTime;
+  for (size_t i = 0; i < NumPhases; ++i) {
+    fextl::fmt::print(stderr, "  {:<20} {:8.3f} ms\n", Phases[i].Name, (Phases[i].Time - Previous) / 1'000'000.0);
+    Previous = Phases[i].Time;
+  }
+  fextl::fmt::print(stderr, "  {:<20} {:8.3f} ms\n", "Total", (Previous - StartTime) / 1'000'000.0);
+}
+} // namespace FEX::StartupTrace
+
 /**
  * @brief Get an FD from an environment variable and then unset the environment variable.
  *
@@ -306,6 +354,7 @@ static int StealFEXFDFromEnv(const char* Env) {
 }
 
 int main(int argc, char** argv, char** const envp) {
+  FEX::StartupTrace::Begin();
   auto SBRKPointer = FEXCore::Allocator::DisableSBRKAllocations();
   FEXCore::Allocator::GLIBCScopedFault GLIBFaultScope;
 
@@ -316,6 +365,7 @@ int main(int argc, char** argv, char** const envp) {
 
   int FEXFD {StealFEXFDFromEnv("FEX_EXECVEFD")};
   int FEXSeccompFD {StealFEXFDFromEnv("FEX_SECCOMPFD")};
+  int FEXStateFD {StealFEXFDFromEnv("FEX_EXECVESTATEFD")};
 
   LogMan::Throw::InstallHandler(AssertHandler);
   LogMan::Msg::InstallHandler(MsgHandler);
@@ -330,8 +380,15 @@ int main(int argc, char** argv, char** const envp) {
     // Early exit if we weren't passed an argument
     return 0;
   }
+  FEX::StartupTrace::Mark("Arguments");
+
+  if (FEXStateFD != -1) {
+    FEX::ExecveState::LoadInherited(FEXStateFD);
+  }
+  auto& InheritedState = FEX::ExecveState::GetInherited();
 
   FEX::Config::LoadConfig(std::move(ArgsLoader), Program.ProgramName, envp, PortableInfo);
+  FEX::StartupTrace::Mark("Config load");
 
   // Reload the meta layer
   FEXCore::Config::ReloadMetaLayer();
@@ -341,6 +398,7 @@ int main(int argc, char** argv, char** const envp) {
   // If running under the vixl simulator, ensure that indirect runtime calls are enabled.
   FEXCore::Config::EraseSet(FEXCore::Config::CONFIG_DISABLE_VIXL_INDIRECT_RUNTIME_CALLS, "0");
 #endif
+  FEX::StartupTrace::Mark("Meta layer");
 
   // Early check for process stall
   // Doesn't use CONFIG_ROOTFS and we don't want it to spin up a squashfs instance
@@ -354,10 +412,15 @@ int main(int argc, char** argv, char** const envp) {
   }
 
   // Ensure FEXServer is setup before config options try to pull CONFIG_ROOTFS
-  if (!FEXServerClient::SetupClient(argv[0])) {
+  // Connect again if the inherited socket isn't to the server this process would use.
+  const bool InheritedClient = InheritedState && InheritedState->ServerFD != -1 &&
+                               FEXServerClient::SetupInheritedClient(std::exchange(InheritedState->ServerFD, -1), InheritedState->ServerRootFSPath,
+                                                                     InheritedState->ServerEUID, InheritedState->ServerSocketName);
+  if (!InheritedClient && !FEXServerClient::SetupClient(argv[0])) {
     LogMan::Msg::EFmt("FEXServerClient: Failure to setup client");
     return -1;
   }
+  FEX::StartupTrace::Mark("FEXServer client");
 
   FEX_CONFIG_OPT(SilentLog, SILENTLOG);
   FEX_CONFIG_OPT(AOTIRCapture, AOTIRCAPTURE);
@@ -414,6 +477,7 @@ int main(int argc, char** argv, char** const envp) {
     fextl::fmt::print(stderr, "{}: command not found\n", Program.ProgramPath);
     return -ENOEXEC;
   }
+  FEX::StartupTrace::Mark("Logging and rootfs");
 
   uint32_t KernelVersion = FEX::HLE::SyscallHandler::CalculateHostKernelVersion();
   if (KernelVersion < FEX::HLE::SyscallHandler::KernelVersion(4, 17)) {
@@ -429,6 +493,7 @@ int main(int argc, char** argv, char** const envp) {
   }
 
   ELFCodeLoader Loader {Program.ProgramPath, FEXFD, LDPath(), Args, ParsedArgs, envp, &Environment};
+  FEX::StartupTrace::Mark("ELF parse");
 
   if (!Loader.ELFWasLoaded()) {
     // Loader couldn't load this program for some reason
@@ -496,19 +561,24 @@ int main(int argc, char** argv, char** const envp) {
     free(data);
   }
 
+  FEX::StartupTrace::Mark("Address space");
+
   // System allocator is now system allocator or FEX
   FEXCore::Context::InitializeStaticTables(Loader.Is64BitMode() ? FEXCore::Context::MODE_64BIT : FEXCore::Context::MODE_32BIT);
+  FEX::StartupTrace::Mark("X86 tables");
 
   bool SupportsAVX {};
   fextl::unique_ptr<FEXCore::Context::Context> CTX;
   {
-    auto HostFeatures = FEX::FetchHostFeatures();
+    auto HostFeatures = InheritedState ? FEX::FetchHostFeatures(InheritedState->CPUMIDRs) : FEX::FetchHostFeatures();
+    FEX::ExecveState::SetCPUMIDRs(HostFeatures.CPUMIDRs);
     CTX = FEXCore::Context::Context::CreateNewContext(HostFeatures);
     SupportsAVX = HostFeatures.SupportsAVX;
   }
 
   // Setup TSO hardware emulation immediately after initializing the context.
   FEX::TSO::SetupTSOEmulation(CTX.get());
+  FEX::StartupTrace::Mark("Context");
 
   auto SignalDelegation = FEX::HLE::CreateSignalDelegator(CTX.get(), Program.ProgramName, SupportsAVX);
   auto ThunkHandler = FEX::HLE::CreateThunkHandler();
@@ -516,9 +586,14 @@ int main(int argc, char** argv, char** const envp) {
   auto SyscallHandler = Loader.Is64BitMode() ?
                           FEX::HLE::x64::CreateHandler(CTX.get(), SignalDelegation.get(), ThunkHandler.get()) :
                           FEX::HLE::x32::CreateHandler(CTX.get(), SignalDelegation.get(), ThunkHandler.get(), std::move(Allocator));
+  FEX::StartupTrace::Mark("Syscall handler");
+
+  // The syscall handler took whatever it could use.
+  FEX::ExecveState::CloseInherited();
 
   // Load VDSO in to memory prior to mapping our ELFs.
   auto VDSOMapping = FEX::VDSO::LoadVDSOThunks(Loader.Is64BitMode(), SyscallHandler.get());
+  FEX::StartupTrace::Mark("VDSO");
 
   // Now that we have the syscall handler. Track some FDs that are FEX owned.
   if (OutputFD != -1) {
@@ -539,6 +614,7 @@ int main(int argc, char** argv, char** const envp) {
       return -ENOEXEC;
     }
   }
+  FEX::StartupTrace::Mark("ELF map");
 
   SyscallHandler->SetCodeLoader(&Loader);
 
@@ -615,6 +691,9 @@ int main(int argc, char** argv, char** const envp) {
     });
   }
 
+  FEX::StartupTrace::Mark("Core and thread init");
+  FEX::StartupTrace::Report(Program.ProgramName);
+
   if (AOTIRGenerate()) {
     for (auto& Section : Loader.Sections) {
       FEX::AOT::AOTGenSection(CTX.get(), Section);
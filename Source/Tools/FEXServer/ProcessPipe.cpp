@@ -3,7 +3,9 @@
 #include "Logger.h"
 #include "SquashFS.h"
 
+#include "Common/ExecveState.h"
 #include "Common/FEXServerClient.h"
+#include "Common/HostFeatures.h"
 
 #include <atomic>
 #include <fcntl.h>
@@ -23,6 +25,8 @@ std::atomic<bool> ShouldShutdown {false};
 time_t RequestTimeout {10};
 bool Foreground {false};
 std::vector<struct pollfd> PollFDs {};
+// Startup state shared by every new client, created on the first request.
+int StartupStateFD {-1};
 
 // FD count watching
 constexpr size_t static MAX_FD_DISTANCE = 32;
@@ -270,6 +274,24 @@ void SendFDSuccessPacket(int Socket, int FD) {
   sendmsg(Socket, &msg, 0);
 }
 
+int GetStartupStateFD() {
+  if (StartupStateFD != -1) {
+    return StartupStateFD;
+  }
+
+  // Reading the MIDRs walks sysfs once per CPU, do that once here instead of in every client.
+  FEXCore::HostFeatures Features {};
+  FEX::FillMIDRInformationViaLinux(&Features);
+  FEX::ExecveState::SetCPUMIDRs(Features.CPUMIDRs);
+
+  StartupStateFD = FEX::ExecveState::SerializeStartupState(SquashFS::GetMountFolder());
+  if (StartupStateFD != -1) {
+    ++NumFilesOpened;
+    CheckRaiseFDLimit();
+  }
+  return StartupStateFD;
+}
+
 void HandleSocketData(int Socket) {
   std::vector<uint8_t> Data(1500);
   size_t CurrentRead {};
@@ -404,12 +426,43 @@ void HandleSocketData(int Socket) {
       CurrentOffset += sizeof(FEXServerClient::FEXServerRequestPacket::Header);
       break;
     }
+    case FEXServerClient::PacketType::TYPE_GET_ROOTFS_INDEX_FD: {
+      int FD = SquashFS::GetRootFSIndexFD();
+
+      if (FD == -1) {
+        // Not a rootfs image or still indexing. The client falls back to asking the kernel.
+        SendEmptyErrorPacket(Socket);
+      } else {
+        // The index stays open for the next client.
+        SendFDSuccessPacket(Socket, FD);
+      }
+
+      CurrentOffset += sizeof(FEXServerClient::FEXServerRequestPacket::Header);
+      break;
+    }
+    case FEXServerClient::PacketType::TYPE_GET_STARTUP_STATE_FD: {
+      int FD = GetStartupStateFD();
+
+      if (FD == -1) {
+        // The client reads everything itself instead.
+        SendEmptyErrorPacket(Socket);
+      } else {
+        // The state stays open for the next client.
+        SendFDSuccessPacket(Socket, FD);
+      }
+
+      CurrentOffset += sizeof(FEXServerClient::FEXServerRequestPacket::Header);
+      break;
+    }
       // Invalid
     case FEXServerClient::PacketType::TYPE_ERROR:
     default:
       // Something sent us an invalid packet. To ensure we don't spin infinitely, consume all the data.
       LogMan::Msg::EFmt("[FEXServer] InvalidPacket size received 0x{:x} bytes", CurrentRead - CurrentOffset);
       CurrentOffset = CurrentRead;
+
+      // Always answer so a client from a newer FEX version doesn't wait on a request we don't know.
+      SendEmptyErrorPacket(Socket);
       break;
     }
   }
@@ -8,4 +8,11 @@ bool InitializeServerSocket();
 void WaitForRequests();
 void SetConfiguration(bool Foreground, uint32_t PersistentTimeout);
 void Shutdown();
+
+/**
+ * @brief Reads and answers the requests a client has sent on Socket
+ *
+ * Requests this server doesn't know get an error packet back.
+ */
+void HandleSocketData(int Socket);
 } // namespace ProcessPipe
@@ -1,11 +1,13 @@
 // SPDX-License-Identifier: MIT
 #include "Common/FEXServerClient.h"
 #include "Common/FileFormatCheck.h"
+#include "Common/RootFSIndex.h"
 
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Utils/LogManager.h>
 #include <FEXCore/fextl/string.h>
 
+#include <atomic>
 #include <fcntl.h>
 #include <filesystem>
 #include <sys/poll.h>
@@ -19,6 +21,13 @@ int ServerRootFSLockFD {-1};
 int FuseMountPID {};
 fextl::string MountFolder {};
 
+// Index of the mounted image that gets shared with every client.
+// Built in the background on the first request, since walking a large image through FUSE takes a while.
+bool MountedImage {};
+std::thread RootFSIndexThread {};
+std::atomic<int> RootFSIndexFD {-1};
+std::atomic<bool> CancelRootFSIndex {false};
+
 void ShutdownImagePID() {
   if (FuseMountPID) {
     FHU::Syscalls::tgkill(FuseMountPID, FuseMountPID, SIGINT);
@@ -192,6 +201,15 @@ void UnmountRootFS() {
     return;
   }
 
+  if (RootFSIndexThread.joinable()) {
+    CancelRootFSIndex = true;
+    RootFSIndexThread.join();
+  }
+
+  if (RootFSIndexFD != -1) {
+    close(RootFSIndexFD.exchange(-1));
+  }
+
   SquashFS::ShutdownImagePID();
 
   // Handle final mount removal
@@ -262,10 +280,32 @@ bool InitializeSquashFS() {
     return false;
   }
 
+  MountedImage = true;
   return true;
 }
 
 const fextl::string& GetMountFolder() {
   return MountFolder;
 }
+
+int GetRootFSIndexFD() {
+  if (!MountedImage) {
+    return -1;
+  }
+
+  // The image is immutable, so it only needs to be indexed once.
+  // Only called from the request thread, so starting the thread doesn't race.
+  if (!RootFSIndexThread.joinable()) {
+    RootFSIndexThread = std::thread([]() {
+      int FD = FEX::RootFSIndex::Build(MountFolder, CancelRootFSIndex);
+      if (FD == -1) {
+        LogMan::Msg::DFmt("[FEXServer] Couldn't build rootfs index");
+        return;
+      }
+      RootFSIndexFD = FD;
+    });
+  }
+
+  return RootFSIndexFD;
+}
 } // namespace SquashFS
@@ -6,4 +6,13 @@ namespace SquashFS {
 bool InitializeSquashFS();
 void UnmountRootFS();
 const fextl::string& GetMountFolder();
+
+/**
+ * @brief Sealed memfd holding the index of the mounted rootfs image
+ *
+ * The first call starts indexing the image in the background.
+ *
+ * @return FD owned by the server, or -1 if there is no image or it hasn't been indexed yet
+ */
+int GetRootFSIndexFD();
 } // namespace SquashFS
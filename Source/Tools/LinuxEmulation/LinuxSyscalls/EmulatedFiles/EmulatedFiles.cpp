@@ -582,6 +582,17 @@ EmulatedFDManager::EmulatedFDManager(FEXCore::Context::Context* ctx)
 
 EmulatedFDManager::~EmulatedFDManager() {}
 
+void EmulatedFDManager::AddFile(const fextl::string& Path, fextl::string Contents) {
+  FDReadCreators[Path] = [Contents = std::move(Contents)](FEXCore::Context::Context* ctx, int32_t fd, const char* pathname,
+                                                          int32_t flags, mode_t mode) -> int32_t {
+    int FD = GenTmpFD(pathname, flags);
+    write(FD, Contents.data(), Contents.size());
+    lseek(FD, 0, SEEK_SET);
+    SealTmpFD(FD);
+    return FD;
+  };
+}
+
 int32_t EmulatedFDManager::OpenAt(int dirfs, const char* pathname, int flags, uint32_t mode) {
   char Tmp[PATH_MAX];
   const char* Path {};
@@ -25,6 +25,9 @@ public:
   ~EmulatedFDManager();
   int32_t OpenAt(int dirfs, const char* pathname, int flags, uint32_t mode);
 
+  // Adds a read-only file with fixed contents that replaces the guest's file at this path
+  void AddFile(const fextl::string& Path, fextl::string Contents);
+
 private:
   FEXCore::Context::Context* CTX;
   fextl::string cpus_online {};
@@ -7,7 +7,9 @@ $end_info$
 */
 
 #include "Common/Config.h"
+#include "Common/ExecveState.h"
 #include "Common/FDUtils.h"
+#include "Common/FEXServerClient.h"
 #include "Common/JSONPool.h"
 
 #include "FEXCore/Config/Config.h"
@@ -128,6 +130,10 @@ void FileManager::LoadThunkDatabase(fextl::unordered_map<fextl::string, ThunkDBO
               DBObject->second.Depends.insert(json_getValue(Depend));
             }
           }
+        } else if (ItemName == "Preload") {
+          // "Preload": true
+          // The guest library interposes functions of the guest's own library instead of replacing it
+          DBObject->second.Preload = json_getType(LibraryItem) == JSON_BOOLEAN && json_getBoolean(LibraryItem);
         } else if (ItemName == "Overlay") {
           auto AddWithReplacement = [HomeDirectory, &PathPrefixes](ThunkDBObject& DBObject, fextl::string LibraryItem) {
             // Walk through template string and fill in prefixes from right to left
@@ -221,11 +227,24 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
   }
 
   if (!LDPath().empty()) {
-    RootFSFD = open(LDPath().c_str(), O_DIRECTORY | O_PATH | O_CLOEXEC);
+    auto& Inherited = FEX::ExecveState::GetInherited();
+    if (Inherited && Inherited->RootFSFD != -1 && Inherited->RootFSPath == LDPath()) {
+      RootFSFD = std::exchange(Inherited->RootFSFD, -1);
+      fcntl(RootFSFD, F_SETFD, FD_CLOEXEC);
+    } else {
+      RootFSFD = open(LDPath().c_str(), O_DIRECTORY | O_PATH | O_CLOEXEC);
+    }
+
     if (RootFSFD == -1) {
       RootFSFD = AT_FDCWD;
     } else {
       TrackFEXFD(RootFSFD);
+
+      // FEXServer only indexes the rootfs image it mounted. The index is requested on the first lookup, so
+      // processes that never look up a rootfs path don't make the server walk the image.
+      const auto& ServerRootFSPath = FEXServerClient::GetServerRootFSPath();
+      RootFSIndexAvailable = FEXServerClient::GetServerFD() != -1 && ServerRootFSPath && *ServerRootFSPath == LDPath() &&
+                             LDPath().starts_with(FEXServerClient::GetServerMountFolder() + "/.FEXMount");
     }
   }
 
@@ -263,6 +282,7 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
 
   // Now that we loaded the thunks object, walk through and ensure dependencies are enabled as well
   auto ThunkGuestPath = Is64BitMode() ? ThunkGuestLibs() : ThunkGuestLibs32();
+  fextl::vector<fextl::string> ThunkPreloads;
   for (const auto& DBObject : ThunkDB) {
     if (!DBObject.second.Enabled) {
       continue;
@@ -272,6 +292,7 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
     // Using a local struct for this is slightly less ugly than using self-capturing lambdas
     struct {
       decltype(FileManager::ThunkOverlays)& ThunkOverlays;
+      fextl::vector<fextl::string>& ThunkPreloads;
       decltype(ThunkDB)& ThunkDB;
       const fextl::string& ThunkGuestPath;
       bool Is64BitMode;
@@ -290,6 +311,10 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
           // Direct full path in guest RootFS to our overlay file
           ThunkOverlays.emplace(Overlay, ThunkPath);
         }
+
+        if (DBDepend.Preload) {
+          ThunkPreloads.emplace_back(std::move(ThunkPath));
+        }
       };
 
       void InsertDependencies(const fextl::unordered_set<fextl::string>& Depends) {
@@ -306,12 +331,16 @@ FileManager::FileManager(FEXCore::Context::Context* ctx)
           InsertDependencies(DBDepend.Depends);
         }
       };
-    } DBObjectHandler {ThunkOverlays, ThunkDB, ThunkGuestPath, Is64BitMode()};
+    } DBObjectHandler {ThunkOverlays, ThunkPreloads, ThunkDB, ThunkGuestPath, Is64BitMode()};
 
     DBObjectHandler.SetupOverlay(DBObject.second);
     DBObjectHandler.InsertDependencies(DBObject.second.Depends);
   }
 
+  if (!ThunkPreloads.empty()) {
+    SetupThunkPreloadFile(ThunkPreloads);
+  }
+
   if (false) {
     // Useful for debugging
     if (ThunkOverlays.size()) {
@@ -329,6 +358,32 @@ FileManager::~FileManager() {
   close(RootFSFD);
 }
 
+static constexpr std::string_view LDPreloadFile = "/etc/ld.so.preload";
+
+void FileManager::SetupThunkPreloadFile(const fextl::vector<fextl::string>& ThunkPreloads) {
+  // Keep what the guest already preloads, the file from the rootfs takes priority like any other guest file
+  fextl::vector<char> FileData;
+  auto RootFSFile = GetEmulatedPath(LDPreloadFile.data(), true);
+  if (RootFSFile.empty() || !FEXCore::FileLoading::LoadFile(FileData, RootFSFile)) {
+    FEXCore::FileLoading::LoadFile(FileData, fextl::string(LDPreloadFile));
+  }
+
+  fextl::string Contents(FileData.begin(), FileData.end());
+  for (const auto& Library : ThunkPreloads) {
+    Contents += '\n';
+    Contents += Library;
+  }
+  Contents += '\n';
+
+  EmuFD.AddFile(fextl::string(LDPreloadFile), std::move(Contents));
+  HasThunkPreloadFile = true;
+}
+
+bool FileManager::IsThunkPreloadFile(const char* pathname, int mode) const {
+  // The dynamic loader checks for read access before opening the file, which may not exist on disk
+  return HasThunkPreloadFile && pathname && LDPreloadFile == pathname && (mode & (W_OK | X_OK)) == 0;
+}
+
 fextl::string FileManager::GetEmulatedPath(const char* pathname, bool FollowSymlink) {
   if (!pathname ||                  // If no pathname
       pathname[0] != '/' ||         // If relative
@@ -391,6 +446,15 @@ std::pair<int, const char*> FileManager::GetEmulatedFDPath(int dirfd, const char
     return NoEntry;
   }
 
+  if (FollowSymlink && RootFSIndexAvailable) {
+    std::call_once(RootFSIndexRequested, [this]() { LoadRootFSIndex(); });
+    if (RootFSIndex.IsLoaded()) {
+      if (auto Result = GetEmulatedFDPathFromIndex(pathname, TmpFilename)) {
+        return *Result;
+      }
+    }
+  }
+
   // Starting subpath is the pathname passed in.
   const char* SubPath = pathname;
 
@@ -453,6 +517,52 @@ std::pair<int, const char*> FileManager::GetEmulatedFDPath(int dirfd, const char
   return std::make_pair(RootFSFD, &SubPath[1]);
 }
 
+void FileManager::LoadRootFSIndex() {
+  // The index checks that it was built for our rootfs.
+  // While FEXServer is still building it this fails, and this process keeps using the kernel path.
+  int IndexFD = FEXServerClient::RequestRootFSIndexFD(FEXServerClient::GetServerFD());
+  if (IndexFD != -1) {
+    RootFSIndex.Load(IndexFD, LDPath());
+    close(IndexFD);
+  }
+}
+
+std::optional<std::pair<int, const char*>> FileManager::GetEmulatedFDPathFromIndex(const char* pathname, FDPathTmpData& TmpFilename) {
+  // Same walk as the fstatat loop in GetEmulatedFDPath, but answered from the index.
+  // Returns nullopt whenever the index can't answer, the caller then asks the kernel.
+  const char* SubPath = pathname;
+  uint32_t CurrentIndex {};
+
+  for (uint32_t Hops = 0; Hops < FEX::RootFSIndex::MAX_SYMLINK_HOPS; ++Hops) {
+    const auto Entry = RootFSIndex.Lookup(SubPath);
+    if (Entry.Result == FEX::RootFSIndex::LookupResult::Unknown) {
+      return std::nullopt;
+    }
+
+    if (Entry.Result == FEX::RootFSIndex::LookupResult::NotFound) {
+      if (Hops == 0) {
+        // Initial file didn't exist at all
+        return std::make_pair(-1, nullptr);
+      }
+      break;
+    }
+
+    const auto& Target = Entry.Target;
+    if (Entry.Type != FEX::RootFSIndex::EntryType::Symlink || Target.empty() || Target[0] != '/' || Target.size() >= PATH_MAX) {
+      // Relative symlinks are left for the kernel to follow from the returned path.
+      break;
+    }
+
+    auto CurrentTmp = TmpFilename[CurrentIndex];
+    memcpy(CurrentTmp, Target.data(), Target.size());
+    CurrentTmp[Target.size()] = 0;
+    SubPath = CurrentTmp;
+    CurrentIndex ^= 1;
+  }
+
+  return std::make_pair(RootFSFD, &SubPath[1]);
+}
+
 ///< Returns true if the pathname is self and symlink flags are set NOFOLLOW.
 bool FileManager::IsSelfNoFollow(const char* Pathname, int flags) const {
   const bool Follow = (flags & AT_SYMLINK_NOFOLLOW) == 0;
@@ -590,6 +700,10 @@ uint64_t FileManager::Access(const char* pathname, [[maybe_unused]] int mode) {
   auto NewPath = GetSelf(pathname);
   const char* SelfPath = NewPath ? NewPath->data() : nullptr;
 
+  if (IsThunkPreloadFile(SelfPath, mode)) {
+    return 0;
+  }
+
   // Access follows symlinks
   FDPathTmpData TmpFilename;
   auto Path = GetEmulatedFDPath(AT_FDCWD, SelfPath, true, TmpFilename);
@@ -606,6 +720,10 @@ uint64_t FileManager::FAccessat(int dirfd, const char* pathname, int mode) {
   auto NewPath = GetSelf(pathname);
   const char* SelfPath = NewPath ? NewPath->data() : nullptr;
 
+  if (IsThunkPreloadFile(SelfPath, mode)) {
+    return 0;
+  }
+
   FDPathTmpData TmpFilename;
   auto Path = GetEmulatedFDPath(dirfd, SelfPath, true, TmpFilename);
   if (Path.first != -1) {
@@ -622,6 +740,10 @@ uint64_t FileManager::FAccessat2(int dirfd, const char* pathname, int mode, int
   auto NewPath = GetSelf(pathname);
   const char* SelfPath = NewPath ? NewPath->data() : nullptr;
 
+  if (IsThunkPreloadFile(SelfPath, mode)) {
+    return 0;
+  }
+
   FDPathTmpData TmpFilename;
   auto Path = GetEmulatedFDPath(dirfd, SelfPath, (flags & AT_SYMLINK_NOFOLLOW) == 0, TmpFilename);
   if (Path.first != -1) {
@@ -21,6 +21,7 @@ $end_info$
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "Common/RootFSIndex.h"
 #include "LinuxSyscalls/EmulatedFiles/EmulatedFiles.h"
 
 namespace FEXCore::Context {
@@ -85,6 +86,14 @@ public:
     CurrentPID = PID;
   }
 
+  int GetRootFSFD() const {
+    return RootFSFD;
+  }
+
+  const fextl::string& GetRootFSPath() const {
+    return LDPath();
+  }
+
   fextl::string GetEmulatedPath(const char* pathname, bool FollowSymlink = false);
   using FDPathTmpData = std::array<char[PATH_MAX], 2>;
   std::pair<int, const char*> GetEmulatedFDPath(int dirfd, const char* pathname, bool FollowSymlink, FDPathTmpData& TmpFilename);
@@ -146,6 +155,7 @@ private:
     fextl::string LibraryName;
     fextl::unordered_set<fextl::string> Depends;
     fextl::vector<fextl::string> Overlays;
+    bool Preload {};
     bool Enabled {};
   };
   void LoadThunkDatabase(fextl::unordered_map<fextl::string, ThunkDBObject>& ThunkDB, bool Global);
@@ -153,6 +163,13 @@ private:
 
   fextl::map<fextl::string, fextl::string, std::less<>> ThunkOverlays;
 
+  // Guest thunk libraries that interpose a guest library instead of replacing it are listed in an emulated
+  // /etc/ld.so.preload. Unlike LD_PRELOAD this doesn't show up in the guest environment and isn't inherited
+  // by child processes, which set up their own thunks.
+  bool HasThunkPreloadFile {};
+  void SetupThunkPreloadFile(const fextl::vector<fextl::string>& ThunkPreloads);
+  bool IsThunkPreloadFile(const char* pathname, int mode) const;
+
   FEX_CONFIG_OPT(Filename, APP_FILENAME);
   FEX_CONFIG_OPT(LDPath, ROOTFS);
   FEX_CONFIG_OPT(ThunkGuestLibs, THUNKGUESTLIBS);
@@ -162,5 +179,13 @@ private:
   FEX_CONFIG_OPT(Is64BitMode, IS64BIT_MODE);
   uint32_t CurrentPID {};
   int RootFSFD {AT_FDCWD};
+
+  // Index of the rootfs image shared by FEXServer. Answers most lookups without touching the filesystem.
+  // Only available when the rootfs is the image FEXServer mounted, and requested on the first lookup.
+  bool RootFSIndexAvailable {};
+  std::once_flag RootFSIndexRequested;
+  FEX::RootFSIndex::Reader RootFSIndex;
+  void LoadRootFSIndex();
+  std::optional<std::pair<int, const char*>> GetEmulatedFDPathFromIndex(const char* pathname, FDPathTmpData& TmpFilename);
 };
 } // namespace FEX::HLE
@@ -646,13 +646,8 @@ void SignalDelegator::HandleGuestSignal(FEX::HLE::ThreadStateObject* ThreadObjec
         NewMask |= (1ULL << (Signal - 1));
       }
 
-      // Walk our required signals and stop masking them if requested
-      for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-        if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-          // Never mask our required signals
-          NewMask &= ~(1ULL << i);
-        }
-      }
+      // Never mask our required signals
+      NewMask &= ~RequiredSignalMask.load(std::memory_order_relaxed);
 
       // Update our host signal mask so we don't hit race conditions with signals
       // This allows us to maintain the expected signal mask through the guest signal handling and then all the way back again
@@ -753,17 +748,10 @@ bool SignalDelegator::UpdateHostThunk(int Signal) {
   SignalHandler.HostAction.restorer = sigrestore;
 #endif
 
-  // Walk the signals we have that are required and make sure to remove it from the mask
-  // This'll likely be SIGILL, SIGBUS, SIG63
-
   // If the guest has masked some signals then we need to also mask those signals
-  for (size_t i = 1; i < HostHandlers.size(); ++i) {
-    if (HostHandlers[i].Required.load(std::memory_order_relaxed)) {
-      SignalHandler.HostAction.sa_mask &= ~(1ULL << (i - 1));
-    } else if (SigIsMember(&SignalHandler.GuestAction.sa_mask, i)) {
-      SignalHandler.HostAction.sa_mask |= (1ULL << (i - 1));
-    }
-  }
+  // Required signals are removed from the mask, this'll likely be SIGILL, SIGBUS, SIG63
+  SignalHandler.HostAction.sa_mask |= SignalHandler.GuestAction.sa_mask.Val;
+  SignalHandler.HostAction.sa_mask &= ~RequiredSignalMask.load(std::memory_order_relaxed);
 
   // Check for SIG_IGN
   if (SignalHandler.GuestAction.sigaction_handler.handler == SIG_IGN && HostHandlers[Signal].Required.load(std::memory_order_relaxed) == false) {
@@ -1005,7 +993,7 @@ void SignalDelegator::FrontendRegisterHostSignalHandler(int Signal, bool Require
   // Linux signal handlers are per-process rather than per thread
   // Multiple threads could be calling in to this
   std::lock_guard lk(HostDelegatorMutex);
-  HostHandlers[Signal].Required = Required;
+  SetRequired(Signal, Required);
   InstallHostThunk(Signal);
 }
 
@@ -1013,7 +1001,7 @@ void SignalDelegator::FrontendRegisterFrontendHostSignalHandler(int Signal, bool
   // Linux signal handlers are per-process rather than per thread
   // Multiple threads could be calling in to this
   std::lock_guard lk(HostDelegatorMutex);
-  HostHandlers[Signal].Required = Required;
+  SetRequired(Signal, Required);
   InstallHostThunk(Signal);
 }
 
@@ -1172,15 +1160,10 @@ uint64_t SignalDelegator::GuestSigProcMask(FEX::HLE::ThreadStateObject* Thread,
       return -EINVAL;
     }
 
-    uint64_t HostMask = Thread->SignalInfo.CurrentSignalMask.Val;
     // Now actually set the host mask
     // This will hide from the guest that we are not actually setting all of the masks it wants
-    for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-      if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-        // If it is a required host signal then we can't mask it
-        HostMask &= ~(1ULL << i);
-      }
-    }
+    // If it is a required host signal then we can't mask it
+    uint64_t HostMask = Thread->SignalInfo.CurrentSignalMask.Val & ~RequiredSignalMask.load(std::memory_order_relaxed);
 
     ::syscall(SYS_rt_sigprocmask, SIG_SETMASK, &HostMask, nullptr, 8);
   }
@@ -1275,13 +1258,10 @@ uint64_t SignalDelegator::GuestSignalFD(int fd, const uint64_t* set, size_t sigs
   sigset_t HostSet {};
   sigemptyset(&HostSet);
 
+  // For now skip our internal signals
+  const uint64_t GuestSet = *set & ~RequiredSignalMask.load(std::memory_order_relaxed);
   for (size_t i = 0; i < MAX_SIGNALS; ++i) {
-    if (HostHandlers[i + 1].Required.load(std::memory_order_relaxed)) {
-      // For now skip our internal signals
-      continue;
-    }
-
-    if (*set & (1ULL << i)) {
+    if (GuestSet & (1ULL << i)) {
       sigaddset(&HostSet, i + 1);
     }
   }
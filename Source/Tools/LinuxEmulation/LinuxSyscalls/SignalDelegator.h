@@ -194,6 +194,17 @@ private:
   };
 
   std::array<SignalHandler, MAX_SIGNALS + 1> HostHandlers {};
+  // Mirrors SignalHandler::Required so signal delivery doesn't need to walk every handler.
+  std::atomic<uint64_t> RequiredSignalMask {};
+
+  void SetRequired(int Signal, bool Required) {
+    HostHandlers[Signal].Required = Required;
+    if (Required) {
+      RequiredSignalMask.fetch_or(1ULL << (Signal - 1), std::memory_order_relaxed);
+    } else {
+      RequiredSignalMask.fetch_and(~(1ULL << (Signal - 1)), std::memory_order_relaxed);
+    }
+  }
   bool InstallHostThunk(int Signal);
   bool UpdateHostThunk(int Signal);
 
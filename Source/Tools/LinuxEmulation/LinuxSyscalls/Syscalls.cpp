@@ -8,6 +8,7 @@ $end_info$
 */
 
 #include "CodeLoader.h"
+#include "Common/ExecveState.h"
 
 #include "Linux/Utils/ELFContainer.h"
 #include "Linux/Utils/ELFParser.h"
@@ -41,6 +42,7 @@ $end_info$
 #include <FEXHeaderUtils/Syscalls.h>
 
 #include <algorithm>
+#include <bit>
 #include <alloca.h>
 #include <charconv>
 #include <functional>
@@ -58,6 +60,7 @@ $end_info$
 #include <system_error>
 #include <syscall.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/utsname.h>
 #include <unistd.h>
 
@@ -197,6 +200,29 @@ static bool IsShebangFilename(const fextl::string& Filename) {
   return IsShebang;
 }
 
+// Checks if binfmt_misc runs ELFs of this type with this FEX binary.
+// A different FEXInterpreter, like an older install, doesn't know about the execve state and would leak its FDs to the guest.
+static bool IsBinfmtInterpreterSelf(ELFLoader::ELFContainer::ELFType Type) {
+  const char* Handler =
+    Type == ELFLoader::ELFContainer::ELFType::TYPE_X86_32 ? "/proc/sys/fs/binfmt_misc/FEX-x86" : "/proc/sys/fs/binfmt_misc/FEX-x86_64";
+  fextl::string Data;
+  if (!FEXCore::FileLoading::LoadFile(Data, Handler)) {
+    return false;
+  }
+
+  constexpr std::string_view InterpreterLine = "\ninterpreter ";
+  auto Begin = Data.find(InterpreterLine);
+  if (Begin == fextl::string::npos) {
+    return false;
+  }
+  Begin += InterpreterLine.size();
+  const auto Interpreter = Data.substr(Begin, Data.find('\n', Begin) - Begin);
+
+  struct stat InterpreterBuffer {}, SelfBuffer {};
+  return stat(Interpreter.c_str(), &InterpreterBuffer) == 0 && stat("/proc/self/exe", &SelfBuffer) == 0 &&
+         InterpreterBuffer.st_dev == SelfBuffer.st_dev && InterpreterBuffer.st_ino == SelfBuffer.st_ino;
+}
+
 uint64_t ExecveHandler(FEXCore::Core::CpuStateFrame* Frame, const char* pathname, char* const* argv, char* const* envp, ExecveAtArgs Args) {
   auto SyscallHandler = FEX::HLE::_SyscallHandler;
   fextl::string Filename {};
@@ -208,6 +234,7 @@ uint64_t ExecveHandler(FEXCore::Core::CpuStateFrame* Frame, const char* pathname
   const bool IsFDExec = (Args.flags & AT_EMPTY_PATH) && strlen(pathname) == 0;
   fextl::string FDExecEnv;
   fextl::string FDSeccompEnv;
+  fextl::string FDStateEnv;
 
   bool IsShebang {};
 
@@ -294,12 +321,21 @@ uint64_t ExecveHandler(FEXCore::Core::CpuStateFrame* Frame, const char* pathname
   // Just execve it and let the kernel handle the process
   const bool IsOtherELF = Type == ELFLoader::ELFContainer::ELFType::TYPE_OTHER_ELF;
 
+  // Anything that ends up back in this FEX gets the state that the new process image can reuse.
+  // This includes the FEXServer socket, so the new image doesn't need to reconnect.
+  const bool HandsOverState = !IsOtherELF && (!IsBinfmtCompatible || IsBinfmtInterpreterSelf(Type));
+  const int StateFD = HandsOverState ? FEX::ExecveState::Serialize(SyscallHandler->FM.GetRootFSFD(), SyscallHandler->FM.GetRootFSPath()) : -1;
+  const bool HasState = StateFD != -1;
+
+  auto DiscardStateFD = [&HasState, StateFD]() {
+    if (HasState) {
+      FEX::ExecveState::Discard(StateFD);
+    }
+  };
+
   // Need to copy over envp variables if we are appending data.
-  // Only situation in which an envp copy needs to occur is if we are doing an FD execveat and binfmt_misc can't handle it.
-  // TODO: Additional future tasks that require envp copying in the future:
-  // - seccomp inheritance
-  // - FEXServer FD inheritance (unshare(CLONE_NEWNET))
-  const bool NeedsEnvpCopy = (IsFDExec && !(IsBinfmtCompatible || IsOtherELF)) || HasSeccomp;
+  // This happens for an FD execveat that binfmt_misc can't handle, seccomp inheritance and the execve state.
+  const bool NeedsEnvpCopy = (IsFDExec && !(IsBinfmtCompatible || IsOtherELF)) || HasSeccomp || HasState;
 
   if (NeedsEnvpCopy) {
     if (envp) {
@@ -342,6 +378,11 @@ uint64_t ExecveHandler(FEXCore::Core::CpuStateFrame* Frame, const char* pathname
       EnvpArgs.emplace_back(FDSeccompEnv.data());
     }
 
+    if (HasState) {
+      FDStateEnv = fextl::fmt::format("FEX_EXECVESTATEFD={}", StateFD);
+      EnvpArgs.emplace_back(FDStateEnv.data());
+    }
+
     // Emplace nullptr at the end to stop
     EnvpArgs.emplace_back(nullptr);
 
@@ -353,6 +394,7 @@ uint64_t ExecveHandler(FEXCore::Core::CpuStateFrame* Frame, const char* pathname
     Result = ::syscall(SYS_execveat, Args.dirfd, Filename.c_str(), argv, EnvpPtr, Args.flags);
     CloseSeccompFD();
     CloseFDExecFD();
+    DiscardStateFD();
     SYSCALL_ERRNO();
   }
 
@@ -393,6 +435,7 @@ uint64_t ExecveHandler(FEXCore::Core::CpuStateFrame* Frame, const char* pathname
   Result = ::syscall(SYS_execveat, Args.dirfd, "/proc/self/exe", const_cast<char* const*>(ExecveArgs.data()), EnvpPtr, Args.flags);
   CloseSeccompFD();
   CloseFDExecFD();
+  DiscardStateFD();
 
   SYSCALL_ERRNO();
 }
@@ -784,6 +827,24 @@ uint32_t SyscallHandler::CalculateGuestKernelVersion() {
   return std::max(KernelVersion(5, 0), std::min(KernelVersion(6, 11), GetHostKernelVersion()));
 }
 
+void SyscallHandler::BuildInlineSyscallTable() {
+  if (NeedsSeccomp) {
+    // Seccomp filters need to see every syscall.
+    return;
+  }
+
+  // Matches the syscalls that ConstProp inlines when the syscall number is constant.
+  // The JIT relies on the size being a power of two for its bounds check.
+  InlineSyscallTable.resize(std::bit_ceil(Definitions.size()), -1);
+  for (size_t i = 0; i < Definitions.size(); ++i) {
+    const auto& Def = Definitions[i];
+    if (Def.NumArgs < FEXCore::HLE::SyscallArguments::MAX_ARGS && Def.HostSyscallNumber != -1 &&
+        (Def.Flags & FEXCore::IR::SyscallFlags::NORETURN) != FEXCore::IR::SyscallFlags::NORETURN) {
+      InlineSyscallTable[i] = Def.HostSyscallNumber;
+    }
+  }
+}
+
 uint64_t SyscallHandler::HandleSyscall(FEXCore::Core::CpuStateFrame* Frame, FEXCore::HLE::SyscallArguments* Args) {
   // Grab the return address which will be inside the JIT.
   const uint64_t JITPC = reinterpret_cast<uint64_t>(__builtin_extract_return_addr(__builtin_return_address(0)));
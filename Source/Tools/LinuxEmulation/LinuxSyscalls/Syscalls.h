@@ -165,6 +165,10 @@ public:
     return Def.Flags;
   }
 
+  std::span<const int32_t> GetInlineSyscallTable() const override {
+    return InlineSyscallTable;
+  }
+
   virtual void RegisterSyscall_32(int SyscallNumber, int32_t HostSyscallNumber, FEXCore::IR::SyscallFlags Flags,
 #ifdef DEBUG_STRACE
                                   const fextl::string& TraceFormatString,
@@ -254,6 +258,7 @@ public:
   ///// VMA (Virtual Memory Area) tracking /////
   static bool HandleSegfault(FEXCore::Core::InternalThreadState* Thread, int Signal, void* info, void* ucontext);
   void MarkGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) override;
+  bool IsGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) override;
   // AOTIRCacheEntryLookupResult also includes a shared lock guard, so the pointed AOTIRCacheEntry return can be safely used
   FEXCore::HLE::AOTIRCacheEntryLookupResult LookupAOTIRCacheEntry(FEXCore::Core::InternalThreadState* Thread, uint64_t GuestAddr) final override;
 
@@ -289,6 +294,10 @@ protected:
                                                           .NumArgs = 255,
                                                           .Ptr = reinterpret_cast<void*>(&UnimplementedSyscall),
                                                         }};
+  // Must be called once all syscalls are registered
+  void BuildInlineSyscallTable();
+  fextl::vector<int32_t> InlineSyscallTable;
+
   std::mutex MMapMutex;
 
   // BRK management
@@ -308,7 +317,6 @@ private:
   FEX::HLE::SignalDelegator* SignalDelegation;
   FEX::HLE::ThunkHandler* ThunkHandler;
 
-  std::mutex FutexMutex;
   std::mutex SyscallMutex;
   FEX::CodeLoader* LocalLoader {};
   bool NeedToCheckXID {true};
@@ -163,6 +163,19 @@ void SyscallHandler::MarkGuestExecutableRange(FEXCore::Core::InternalThreadState
   }
 }
 
+bool SyscallHandler::IsGuestExecutableRange(FEXCore::Core::InternalThreadState* Thread, uint64_t Start, uint64_t Length) {
+  auto lk = FEXCore::GuardSignalDeferringSection<std::shared_lock>(VMATracking.Mutex, Thread);
+
+  auto Entry = VMATracking.LookupVMAUnsafe(Start);
+  if (Entry == VMATracking.VMAs.end()) {
+    return false;
+  }
+
+  // Ranges spanning multiple mappings are rare enough to not bother with
+  const auto& VMA = Entry->second;
+  return VMA.Prot.Readable && VMA.Prot.Executable && (Start + Length) <= (VMA.Base + VMA.Length);
+}
+
 // Used for AOT
 FEXCore::HLE::AOTIRCacheEntryLookupResult SyscallHandler::LookupAOTIRCacheEntry(FEXCore::Core::InternalThreadState* Thread, uint64_t GuestAddr) {
   auto lk = FEXCore::GuardSignalDeferringSection<std::shared_lock>(VMATracking.Mutex, Thread);
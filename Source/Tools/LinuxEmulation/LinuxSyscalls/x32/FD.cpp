@@ -19,6 +19,7 @@ $end_info$
 #include <FEXCore/fextl/vector.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <fcntl.h>
 #include <limits>
@@ -53,6 +54,36 @@ static constexpr int SanitizeIOCount(int count) {
   return std::max(0, count);
 }
 
+// Converts a guest iovec array for the readv/writev family of syscalls.
+// Most callers only pass a handful of entries, so these are converted on the
+// stack instead of heap allocating on every syscall.
+class HostIOVec final {
+public:
+  HostIOVec(const struct iovec32* iov, int count) {
+    const size_t Count = SanitizeIOCount(count);
+    if (Count <= InlineIOVec.size()) {
+      std::copy(iov, iov + Count, InlineIOVec.begin());
+      IOVec = InlineIOVec.data();
+    } else {
+      HeapIOVec.assign(iov, iov + Count);
+      IOVec = HeapIOVec.data();
+    }
+  }
+
+  HostIOVec(const HostIOVec&) = delete;
+  HostIOVec& operator=(const HostIOVec&) = delete;
+
+  iovec* data() {
+    return IOVec;
+  }
+
+private:
+  // Matches the kernel's UIO_FASTIOV
+  std::array<iovec, 8> InlineIOVec;
+  fextl::vector<iovec> HeapIOVec;
+  iovec* IOVec;
+};
+
 #ifdef _M_X86_64
 uint32_t ioctl_32(FEXCore::Core::CpuStateFrame*, int fd, uint32_t cmd, uint32_t args) {
   uint32_t Result {};
@@ -299,14 +330,14 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
 
   REGISTER_SYSCALL_IMPL_X32(readv, [](FEXCore::Core::CpuStateFrame* Frame, int fd, const struct iovec32* iov, int iovcnt) -> uint64_t {
     FaultSafeUserMemAccess::VerifyIsReadable(iov, sizeof(struct iovec32) * SanitizeIOCount(iovcnt));
-    fextl::vector<iovec> Host_iovec(iov, iov + SanitizeIOCount(iovcnt));
+    HostIOVec Host_iovec(iov, iovcnt);
     uint64_t Result = ::readv(fd, Host_iovec.data(), iovcnt);
     SYSCALL_ERRNO();
   });
 
   REGISTER_SYSCALL_IMPL_X32(writev, [](FEXCore::Core::CpuStateFrame* Frame, int fd, const struct iovec32* iov, int iovcnt) -> uint64_t {
     FaultSafeUserMemAccess::VerifyIsReadable(iov, sizeof(struct iovec32) * SanitizeIOCount(iovcnt));
-    fextl::vector<iovec> Host_iovec(iov, iov + SanitizeIOCount(iovcnt));
+    HostIOVec Host_iovec(iov, iovcnt);
     uint64_t Result = ::writev(fd, Host_iovec.data(), iovcnt);
     SYSCALL_ERRNO();
   });
@@ -513,7 +544,7 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
   REGISTER_SYSCALL_IMPL_X32(
     preadv, [](FEXCore::Core::CpuStateFrame* Frame, int fd, const struct iovec32* iov, uint32_t iovcnt, uint32_t pos_low, uint32_t pos_high) -> uint64_t {
       FaultSafeUserMemAccess::VerifyIsReadable(iov, sizeof(struct iovec32) * SanitizeIOCount(iovcnt));
-      fextl::vector<iovec> Host_iovec(iov, iov + SanitizeIOCount(iovcnt));
+      HostIOVec Host_iovec(iov, iovcnt);
 
       uint64_t Result = ::syscall(SYSCALL_DEF(preadv), fd, Host_iovec.data(), iovcnt, pos_low, pos_high);
       SYSCALL_ERRNO();
@@ -522,7 +553,7 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
   REGISTER_SYSCALL_IMPL_X32(
     pwritev, [](FEXCore::Core::CpuStateFrame* Frame, int fd, const struct iovec32* iov, uint32_t iovcnt, uint32_t pos_low, uint32_t pos_high) -> uint64_t {
       FaultSafeUserMemAccess::VerifyIsReadable(iov, sizeof(struct iovec32) * SanitizeIOCount(iovcnt));
-      fextl::vector<iovec> Host_iovec(iov, iov + SanitizeIOCount(iovcnt));
+      HostIOVec Host_iovec(iov, iovcnt);
 
       uint64_t Result = ::syscall(SYSCALL_DEF(pwritev), fd, Host_iovec.data(), iovcnt, pos_low, pos_high);
       SYSCALL_ERRNO();
@@ -534,8 +565,8 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
                               FaultSafeUserMemAccess::VerifyIsReadable(local_iov, sizeof(struct iovec32) * SanitizeIOCount(liovcnt));
                               FaultSafeUserMemAccess::VerifyIsReadable(remote_iov, sizeof(struct iovec32) * SanitizeIOCount(riovcnt));
 
-                              fextl::vector<iovec> Host_local_iovec(local_iov, local_iov + SanitizeIOCount(liovcnt));
-                              fextl::vector<iovec> Host_remote_iovec(remote_iov, remote_iov + SanitizeIOCount(riovcnt));
+                              HostIOVec Host_local_iovec(local_iov, liovcnt);
+                              HostIOVec Host_remote_iovec(remote_iov, riovcnt);
 
                               uint64_t Result =
                                 ::process_vm_readv(pid, Host_local_iovec.data(), liovcnt, Host_remote_iovec.data(), riovcnt, flags);
@@ -548,8 +579,8 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
                               FaultSafeUserMemAccess::VerifyIsReadable(local_iov, sizeof(struct iovec32) * SanitizeIOCount(liovcnt));
                               FaultSafeUserMemAccess::VerifyIsReadable(remote_iov, sizeof(struct iovec32) * SanitizeIOCount(riovcnt));
 
-                              fextl::vector<iovec> Host_local_iovec(local_iov, local_iov + SanitizeIOCount(liovcnt));
-                              fextl::vector<iovec> Host_remote_iovec(remote_iov, remote_iov + SanitizeIOCount(riovcnt));
+                              HostIOVec Host_local_iovec(local_iov, liovcnt);
+                              HostIOVec Host_remote_iovec(remote_iov, riovcnt);
 
                               uint64_t Result =
                                 ::process_vm_writev(pid, Host_local_iovec.data(), liovcnt, Host_remote_iovec.data(), riovcnt, flags);
@@ -560,7 +591,7 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
                             [](FEXCore::Core::CpuStateFrame* Frame, int fd, const struct iovec32* iov, uint32_t iovcnt, uint32_t pos_low,
                                uint32_t pos_high, int flags) -> uint64_t {
                               FaultSafeUserMemAccess::VerifyIsReadable(iov, sizeof(struct iovec32) * SanitizeIOCount(iovcnt));
-                              fextl::vector<iovec> Host_iovec(iov, iov + SanitizeIOCount(iovcnt));
+                              HostIOVec Host_iovec(iov, iovcnt);
 
                               uint64_t Result = ::syscall(SYSCALL_DEF(preadv2), fd, Host_iovec.data(), iovcnt, pos_low, pos_high, flags);
                               SYSCALL_ERRNO();
@@ -570,7 +601,7 @@ void RegisterFD(FEX::HLE::SyscallHandler* Handler) {
                             [](FEXCore::Core::CpuStateFrame* Frame, int fd, const struct iovec32* iov, uint32_t iovcnt, uint32_t pos_low,
                                uint32_t pos_high, int flags) -> uint64_t {
                               FaultSafeUserMemAccess::VerifyIsReadable(iov, sizeof(struct iovec32) * SanitizeIOCount(iovcnt));
-                              fextl::vector<iovec> Host_iovec(iov, iov + SanitizeIOCount(iovcnt));
+                              HostIOVec Host_iovec(iov, iovcnt);
 
                               uint64_t Result = ::syscall(SYSCALL_DEF(pwritev2), fd, Host_iovec.data(), iovcnt, pos_low, pos_high, flags);
                               SYSCALL_ERRNO();
@@ -48,6 +48,7 @@ x32SyscallHandler::x32SyscallHandler(FEXCore::Context::Context* ctx, FEX::HLE::S
   , AllocHandler {std::move(Allocator)} {
   OSABI = FEXCore::HLE::SyscallOSABI::OS_LINUX32;
   RegisterSyscallHandlers();
+  BuildInlineSyscallTable();
 }
 
 void x32SyscallHandler::RegisterSyscallHandlers() {
@@ -28,6 +28,7 @@ x64SyscallHandler::x64SyscallHandler(FEXCore::Context::Context* ctx, FEX::HLE::S
   OSABI = FEXCore::HLE::SyscallOSABI::OS_LINUX64;
 
   RegisterSyscallHandlers();
+  BuildInlineSyscallTable();
 }
 
 void x64SyscallHandler::RegisterSyscallHandlers() {
@@ -90,8 +90,9 @@ ComputeDataLayout(const clang::ASTContext& context, const std::unordered_map<con
         .member_name = field->getNameAsString(),
         .array_size = array_size,
         .is_function_pointer = field_type->isFunctionPointerType(),
-        .is_integral = field->getType()->isIntegerType(),
-        .is_signed_integer = field->getType()->isSignedIntegerType(),
+        // For arrays, this refers to the element type
+        .is_integral = field_type->isIntegerType(),
+        .is_signed_integer = field_type->isSignedIntegerType(),
       };
 
       // TODO: Process types in dependency-order. Currently we skip this
@@ -162,10 +163,11 @@ ABI GetStableLayout(const clang::ASTContext& context, const std::unordered_map<c
       for (auto& member : struct_info->members) {
         if (member.is_integral) {
           // Map member types to fixed-size integers
-          auto alt_type_name = get_fixed_size_int_name(member.is_signed_integer, member.size_bits);
+          const auto element_size_bits = member.size_bits / member.array_size.value_or(1);
+          auto alt_type_name = get_fixed_size_int_name(member.is_signed_integer, element_size_bits);
           auto alt_type_info = SimpleTypeInfo {
-            .size_bits = member.size_bits,
-            .alignment_bits = context.getTypeAlign(context.getIntTypeForBitwidth(member.size_bits, member.is_signed_integer)),
+            .size_bits = element_size_bits,
+            .alignment_bits = context.getTypeAlign(context.getIntTypeForBitwidth(element_size_bits, member.is_signed_integer)),
           };
           stable_layout.insert(std::pair {alt_type_name, alt_type_info});
           member.type_name = std::move(alt_type_name);
@@ -165,6 +165,41 @@ void GenerateThunkLibsAction::EmitLayoutWrappers(clang::ASTContext& context, std
       continue;
     }
 
+    // Array members are copied in bulk if their elements have the same data layout on guest and host.
+    // Otherwise, they are converted element by element.
+    auto is_bulk_copyable_array = [&](std::string_view member_name) {
+      auto struct_decl = type->getAsStructureType()->getDecl();
+      auto host_field = std::find_if(struct_decl->field_begin(), struct_decl->field_end(),
+                                     [&](auto* field) { return field->getName() == member_name; });
+      if (host_field == struct_decl->field_end()) {
+        return false;
+      }
+      auto array_type = llvm::dyn_cast<clang::ConstantArrayType>(host_field->getType());
+      if (!array_type) {
+        return false;
+      }
+      auto element_type = context.getCanonicalType(array_type->getElementType().getTypePtr());
+
+      if (element_type->isStructureType()) {
+        return type_compat.contains(element_type) && type_compat.at(element_type) == TypeCompatibility::Full;
+      } else if (!element_type->isBuiltinType() && !element_type->isEnumeralType()) {
+        // Pointers need to be extended on 32-bit and function pointers are handled manually
+        return false;
+      } else if (element_type->isSpecificBuiltinType(clang::BuiltinType::LongDouble)) {
+        // x87 extended precision on the guest, but not on the host. The size may still match.
+        return false;
+      }
+
+      auto& guest_members = guest_abi.at(struct_name).get_if_struct()->members;
+      auto guest_member = std::find_if(guest_members.begin(), guest_members.end(),
+                                       [&](auto& member) { return member.member_name == member_name; });
+      if (guest_member == guest_members.end() || !guest_member->array_size || guest_member->array_size.value() == 0) {
+        return false;
+      }
+      return guest_member->array_size.value() == array_type->getSize().getZExtValue() &&
+             guest_member->size_bits / guest_member->array_size.value() == context.getTypeSize(element_type);
+    };
+
     if (type->isEnumeralType()) {
       fmt::print(file, "template<>\nstruct __attribute__((packed)) guest_layout<{}> {{\n", struct_name);
       fmt::print(file, "  using type = {}int{}_t;\n", type->isUnsignedIntegerOrEnumerationType() ? "u" : "",
@@ -191,8 +226,8 @@ void GenerateThunkLibsAction::EmitLayoutWrappers(clang::ASTContext& context, std
     } else {
       fmt::print(file, "  struct type {{\n");
       for (auto& member : guest_abi.at(struct_name).get_if_struct()->members) {
-        fmt::print(file, "    guest_layout<{}{}> {};\n", member.type_name,
-                   member.array_size ? fmt::format("[{}]", member.array_size.value()) : "", member.member_name);
+        fmt::print(file, "    guest_layout<{}> {}{};\n", member.type_name, member.member_name,
+                   member.array_size ? fmt::format("[{}]", member.array_size.value()) : "");
       }
       fmt::print(file, "  }};\n");
     }
@@ -218,7 +253,7 @@ void GenerateThunkLibsAction::EmitLayoutWrappers(clang::ASTContext& context, std
       // Conversion needs struct repacking.
       // Wrapping each member in `host_layout<>` ensures this is done recursively.
       fmt::print(file, "    data {{\n");
-      auto map_field = [&file](clang::FieldDecl* member, bool skip_arrays) {
+      auto map_field = [&](clang::FieldDecl* member, bool skip_arrays) {
         auto decl_name = member->getNameAsString();
         auto type_name = member->getType().getAsString();
         auto array_type = llvm::dyn_cast<clang::ConstantArrayType>(member->getType());
@@ -229,10 +264,13 @@ void GenerateThunkLibsAction::EmitLayoutWrappers(clang::ASTContext& context, std
           } else {
             fmt::print(file, "      .{} = host_layout<{}> {{ from.data.{} }}.data,\n", decl_name, type_name, decl_name);
           }
+        } else if (array_type && !skip_arrays && is_bulk_copyable_array(decl_name)) {
+          fmt::print(file, "      static_assert(sizeof(data.{}) == sizeof(from.data.{}));\n", decl_name, decl_name);
+          fmt::print(file, "      memcpy(&data.{}, &from.data.{}, sizeof(data.{}));\n", decl_name, decl_name, decl_name);
         } else if (array_type && !skip_arrays) {
-          // Copy element-wise below
           fmt::print(file, "      for (size_t i = 0; i < {}; ++i) {{\n", array_type->getSize().getZExtValue());
-          fmt::print(file, "        data.{}[i] = host_layout<{}> {{ from.data.{} }}.data[i];\n", decl_name, type_name, decl_name);
+          fmt::print(file, "        data.{}[i] = host_layout<{}> {{ from.data.{}[i] }}.data;\n", decl_name,
+                     array_type->getElementType().getAsString(), decl_name);
           fmt::print(file, "      }}\n");
         }
       };
@@ -266,7 +304,7 @@ void GenerateThunkLibsAction::EmitLayoutWrappers(clang::ASTContext& context, std
       // Conversion needs struct repacking.
       // Wrapping each member in `to_guest(to_host_layout(...))` ensures this is done recursively.
       fmt::print(file, "  guest_layout<{}> ret {{ .data {{\n", struct_name);
-      auto map_field2 = [&file](const StructInfo::MemberInfo& member, bool skip_arrays) {
+      auto map_field2 = [&](const StructInfo::MemberInfo& member, bool skip_arrays) {
         auto& decl_name = member.member_name;
         auto& array_size = member.array_size;
         if (!array_size && skip_arrays) {
@@ -276,10 +314,12 @@ void GenerateThunkLibsAction::EmitLayoutWrappers(clang::ASTContext& context, std
           } else {
             fmt::print(file, "    .{} = to_guest(to_host_layout(from.data.{})),\n", decl_name, decl_name);
           }
+        } else if (array_size && !skip_arrays && is_bulk_copyable_array(decl_name)) {
+          fmt::print(file, "    static_assert(sizeof(ret.data.{}) == sizeof(from.data.{}));\n", decl_name, decl_name);
+          fmt::print(file, "    memcpy(&ret.data.{}, &from.data.{}, sizeof(ret.data.{}));\n", decl_name, decl_name, decl_name);
         } else if (array_size && !skip_arrays) {
-          // Copy element-wise below
           fmt::print(file, "    for (size_t i = 0; i < {}; ++i) {{\n", array_size.value());
-          fmt::print(file, "      ret.data.{}.data[i] = to_guest(to_host_layout(from.data.{}[i]));\n", decl_name, decl_name);
+          fmt::print(file, "      ret.data.{}[i] = to_guest(to_host_layout(from.data.{}[i]));\n", decl_name, decl_name);
           fmt::print(file, "    }}\n");
         }
       };
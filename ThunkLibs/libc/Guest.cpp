@@ -0,0 +1,43 @@
+/*
+$info$
+tags: thunklibs|libc
+$end_info$
+*/
+
+// Redirects hot, callback-free functions of the guest libc to their host
+// implementations.
+//
+// This library doesn't replace any guest library and exports nothing. It is
+// preloaded (FEX lists it in the guest's /etc/ld.so.preload) and links the
+// addresses the guest's own functions resolve to over to the thunks. This
+// also catches calls from within the guest libc itself, and the AVX2 variants
+// picked by glibc's ifunc resolvers.
+//
+// libm stays emulated. The host functions would ignore the rounding mode set
+// in the guest MXCSR and wouldn't set the guest's errno.
+
+#include <dlfcn.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/Guest.h"
+
+#include "thunkgen_guest_libc.inl"
+
+static void Link(const char* Name, void* Target) {
+  if (auto Addr = dlsym(RTLD_DEFAULT, Name)) {
+    LinkAddressToFunction(reinterpret_cast<uintptr_t>(Addr), reinterpret_cast<uintptr_t>(Target));
+  }
+}
+
+static void Init() {
+  // glibc implements memcpy with its memmove, so both may resolve to the same
+  // address. Use memmove for both to make that harmless.
+  Link("memcpy", reinterpret_cast<void*>(fexfn_pack_memmove));
+  Link("memmove", reinterpret_cast<void*>(fexfn_pack_memmove));
+  Link("memset", reinterpret_cast<void*>(fexfn_pack_memset));
+  Link("memchr", reinterpret_cast<void*>(fexfn_pack_memchr));
+  Link("strlen", reinterpret_cast<void*>(fexfn_pack_strlen));
+}
+
+LOAD_LIB_INIT(libc, Init)
@@ -0,0 +1,14 @@
+/*
+$info$
+tags: thunklibs|libc
+$end_info$
+*/
+
+#include <string.h>
+
+#include "common/Host.h"
+#include <dlfcn.h>
+
+#include "thunkgen_host_libc.inl"
+
+EXPORTS(libc)
@@ -0,0 +1,29 @@
+#include <common/GeneratorInterface.h>
+
+#include <stddef.h>
+
+// The C++ version of <string.h> overloads some of these, which would make
+// referring to them ambiguous. Declare the C functions directly.
+extern "C" {
+void* memmove(void* dest, const void* src, size_t n);
+void* memset(void* s, int c, size_t n);
+void* memchr(const void* s, int c, size_t n);
+size_t strlen(const char* s);
+}
+
+template<auto>
+struct fex_gen_config {
+  unsigned version = 6;
+};
+
+// None of these are exported from the guest library. The guest's own
+// implementations get linked to the thunks instead, see Guest.cpp.
+template<>
+struct fex_gen_config<memmove> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<memset> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<memchr> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<strlen> : fexgen::custom_guest_entrypoint {};
+
@@ -0,0 +1,738 @@
+/*
+$info$
+tags: thunklibs|crypto
+$end_info$
+*/
+
+// libcrypto objects are passed all over libssl and libcrypto itself, so
+// replacing the guest library like other thunks do isn't workable. Instead
+// this library is preloaded in front of the guest libcrypto (FEX lists it in
+// the guest's /etc/ld.so.preload) and interposes the EVP digest and cipher
+// entry points.
+//
+// Contexts are still set up by the guest libcrypto, so functions that only
+// read their static parameters (algorithm, key and IV length, block size)
+// keep working. A host context of the same algorithm is attached to them on
+// initialization, and does the actual hashing and encryption. The calls
+// interposed below that change the configuration of a context are applied to
+// both. The ones that read running state (updated IV, partial block, stream
+// position, XOF output) are answered by the host context.
+//
+// Any other function only sees the guest context. In particular
+// EVP_CIPHER_CTX_get_app_data and ex_data are left to the guest.
+//
+// Contexts initialized through other paths (signing, verification, envelope
+// encryption), with an ENGINE, or with an algorithm the host doesn't provide
+// stay entirely in the guest. Contexts the guest libcrypto resets, frees or
+// copies on its own are detected through the tags described below.
+
+// The raw IV and buffer accessors are deprecated but still in use
+#define OPENSSL_SUPPRESS_DEPRECATED
+
+#include <openssl/evp.h>
+
+#include <dlfcn.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/Guest.h"
+
+#include "thunkgen_guest_libcrypto.inl"
+
+// Resolves the guest libcrypto's implementation of an interposed function
+#define GUEST_FN(name) static const auto Guest_##name = reinterpret_cast<decltype(&name)>(dlsym(RTLD_NEXT, #name))
+
+// The guest libcrypto can reset, free or copy a context without going
+// through the functions interposed below, and a freed context's memory is
+// reused for the next one. Every attached host context therefore gets a tag,
+// which is also stored in flag bits of the guest context that libcrypto
+// doesn't use. Resetting or allocating a guest context clears them and a copy
+// takes the tag of its source, so a lookup whose tag doesn't match finds a
+// stale host context.
+static constexpr int ContextTagMask = 0x7fff'0000;
+
+static int NextContextTag() {
+  static std::atomic<uint32_t> Counter {};
+  return static_cast<int>((Counter.fetch_add(1, std::memory_order_relaxed) % 0x7fff + 1) << 16);
+}
+
+static int GetContextTag(const EVP_MD_CTX* ctx) {
+  GUEST_FN(EVP_MD_CTX_test_flags);
+  return Guest_EVP_MD_CTX_test_flags(ctx, ContextTagMask);
+}
+
+static void SetContextTag(EVP_MD_CTX* ctx, int Tag) {
+  GUEST_FN(EVP_MD_CTX_clear_flags);
+  GUEST_FN(EVP_MD_CTX_set_flags);
+  Guest_EVP_MD_CTX_clear_flags(ctx, ContextTagMask);
+  Guest_EVP_MD_CTX_set_flags(ctx, Tag);
+}
+
+static int GetContextTag(const EVP_CIPHER_CTX* ctx) {
+  GUEST_FN(EVP_CIPHER_CTX_test_flags);
+  return Guest_EVP_CIPHER_CTX_test_flags(ctx, ContextTagMask);
+}
+
+static void SetContextTag(EVP_CIPHER_CTX* ctx, int Tag) {
+  GUEST_FN(EVP_CIPHER_CTX_clear_flags);
+  GUEST_FN(EVP_CIPHER_CTX_set_flags);
+  Guest_EVP_CIPHER_CTX_clear_flags(ctx, ContextTagMask);
+  Guest_EVP_CIPHER_CTX_set_flags(ctx, Tag);
+}
+
+// Looked up on every update and final call, possibly from many threads at
+// once. The guest context layout is owned by the guest libcrypto and the
+// application owns the cipher app data, so the host context can't be stored
+// in the guest context itself. Instead the map is sharded by context address
+// so that threads working on different contexts don't contend on one lock.
+template<typename Ctx>
+class HostContexts {
+public:
+  HostContexts(Ctx* (*New)(), void (*Free)(Ctx*))
+    : New {New}
+    , Free {Free} {}
+
+  Ctx* Find(const Ctx* Guest) {
+    auto& Shard = GetShard(Guest);
+    Ctx* Stale {};
+    {
+      std::lock_guard lk {Shard.Mutex};
+      auto It = Shard.Contexts.find(Guest);
+      if (It == Shard.Contexts.end()) {
+        return nullptr;
+      }
+
+      if (It->second.Tag == GetContextTag(Guest)) {
+        return It->second.Host;
+      }
+
+      // The guest libcrypto reset, freed or copied over this context on its
+      // own, so it holds the running state now
+      Stale = It->second.Host;
+      Shard.Contexts.erase(It);
+    }
+    Free(Stale);
+    return nullptr;
+  }
+
+  // The caller must initialize the returned host context, it may be reused from a stale entry
+  Ctx* FindOrCreate(Ctx* Guest) {
+    auto& Shard = GetShard(Guest);
+    std::lock_guard lk {Shard.Mutex};
+    auto& Entry = Shard.Contexts[Guest];
+    if (!Entry.Host) {
+      Entry.Host = New();
+      if (!Entry.Host) {
+        Shard.Contexts.erase(Guest);
+        return nullptr;
+      }
+    }
+
+    Entry.Tag = NextContextTag();
+    SetContextTag(Guest, Entry.Tag);
+    return Entry.Host;
+  }
+
+  void Detach(const Ctx* Guest) {
+    auto& Shard = GetShard(Guest);
+    Ctx* Host {};
+    {
+      std::lock_guard lk {Shard.Mutex};
+      auto It = Shard.Contexts.find(Guest);
+      if (It == Shard.Contexts.end()) {
+        return;
+      }
+      Host = It->second.Host;
+      Shard.Contexts.erase(It);
+    }
+    Free(Host);
+  }
+
+private:
+  struct HostContext {
+    Ctx* Host {};
+    int Tag {};
+  };
+
+  struct alignas(64) ContextShard {
+    std::mutex Mutex;
+    std::unordered_map<const Ctx*, HostContext> Contexts;
+  };
+
+  static constexpr size_t NumShards = 64;
+
+  ContextShard& GetShard(const Ctx* Guest) {
+    // Contexts are heap allocated, so the lowest bits are always zero
+    const auto Hash = reinterpret_cast<uintptr_t>(Guest) >> 4;
+    return Shards[(Hash ^ (Hash >> 6)) % NumShards];
+  }
+
+  Ctx* (*New)();
+  void (*Free)(Ctx*);
+
+  std::array<ContextShard, NumShards> Shards;
+};
+
+static HostContexts<EVP_MD_CTX> Digests {fexfn_pack_EVP_MD_CTX_new, fexfn_pack_EVP_MD_CTX_free};
+static HostContexts<EVP_CIPHER_CTX> Ciphers {fexfn_pack_EVP_CIPHER_CTX_new, fexfn_pack_EVP_CIPHER_CTX_free};
+
+// Guest algorithm objects may be freed and their memory reused, so host
+// algorithms are looked up by name. Fetched host algorithms live until exit.
+template<typename Alg>
+static Alg* LookupHostAlgorithm(const char* Name, Alg* (*Fetch)(OSSL_LIB_CTX*, const char*, const char*)) {
+  static std::mutex Mutex;
+  static std::unordered_map<std::string, Alg*> Algorithms;
+
+  if (!Name) {
+    return nullptr;
+  }
+
+  std::lock_guard lk {Mutex};
+  auto [It, Inserted] = Algorithms.try_emplace(Name, nullptr);
+  if (Inserted) {
+    It->second = Fetch(nullptr, Name, nullptr);
+  }
+  return It->second;
+}
+
+static const EVP_MD* LookupHostDigest(const EVP_MD* Type) {
+  GUEST_FN(EVP_MD_get0_name);
+  return LookupHostAlgorithm<EVP_MD>(Guest_EVP_MD_get0_name(Type), fexfn_pack_EVP_MD_fetch);
+}
+
+static const EVP_CIPHER* LookupHostCipher(const EVP_CIPHER* Type) {
+  GUEST_FN(EVP_CIPHER_get0_name);
+  return LookupHostAlgorithm<EVP_CIPHER>(Guest_EVP_CIPHER_get0_name(Type), fexfn_pack_EVP_CIPHER_fetch);
+}
+
+// Called after the guest libcrypto successfully initialized the context
+static void AttachDigest(EVP_MD_CTX* ctx, const EVP_MD* type, ENGINE* impl, const OSSL_PARAM* params) {
+  if (!type) {
+    // Reinitialization with the previous digest
+    auto Host = Digests.Find(ctx);
+    if (Host && !fexfn_pack_EVP_DigestInit_ex2(Host, nullptr, params)) {
+      Digests.Detach(ctx);
+    }
+    return;
+  }
+
+  auto HostType = impl ? nullptr : LookupHostDigest(type);
+  auto Host = HostType ? Digests.FindOrCreate(ctx) : nullptr;
+  if (!Host || !fexfn_pack_EVP_DigestInit_ex2(Host, HostType, params)) {
+    Digests.Detach(ctx);
+  }
+}
+
+static void AttachCipher(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, ENGINE* impl, const unsigned char* key,
+                         const unsigned char* iv, int enc, const OSSL_PARAM* params) {
+  if (!cipher) {
+    // Setting the key or IV of an already initialized context
+    auto Host = Ciphers.Find(ctx);
+    if (Host && !fexfn_pack_EVP_CipherInit_ex2(Host, nullptr, key, iv, enc, params)) {
+      Ciphers.Detach(ctx);
+    }
+    return;
+  }
+
+  auto HostType = impl ? nullptr : LookupHostCipher(cipher);
+  auto Host = HostType ? Ciphers.FindOrCreate(ctx) : nullptr;
+  if (!Host || !fexfn_pack_EVP_CipherInit_ex2(Host, HostType, key, iv, enc, params)) {
+    Ciphers.Detach(ctx);
+  }
+}
+
+extern "C" {
+/* Digests */
+int EVP_DigestInit_ex2(EVP_MD_CTX* ctx, const EVP_MD* type, const OSSL_PARAM params[]) {
+  GUEST_FN(EVP_DigestInit_ex2);
+  int Result = Guest_EVP_DigestInit_ex2(ctx, type, params);
+  if (Result > 0) {
+    AttachDigest(ctx, type, nullptr, params);
+  }
+  return Result;
+}
+
+int EVP_DigestInit_ex(EVP_MD_CTX* ctx, const EVP_MD* type, ENGINE* impl) {
+  GUEST_FN(EVP_DigestInit_ex);
+  int Result = Guest_EVP_DigestInit_ex(ctx, type, impl);
+  if (Result > 0) {
+    AttachDigest(ctx, type, impl, nullptr);
+  }
+  return Result;
+}
+
+int EVP_DigestInit(EVP_MD_CTX* ctx, const EVP_MD* type) {
+  GUEST_FN(EVP_DigestInit);
+  int Result = Guest_EVP_DigestInit(ctx, type);
+  if (Result > 0) {
+    AttachDigest(ctx, type, nullptr, nullptr);
+  }
+  return Result;
+}
+
+int EVP_DigestUpdate(EVP_MD_CTX* ctx, const void* d, size_t cnt) {
+  if (auto Host = Digests.Find(ctx)) {
+    return fexfn_pack_EVP_DigestUpdate(Host, d, cnt);
+  }
+
+  GUEST_FN(EVP_DigestUpdate);
+  return Guest_EVP_DigestUpdate(ctx, d, cnt);
+}
+
+int EVP_DigestFinal_ex(EVP_MD_CTX* ctx, unsigned char* md, unsigned int* s) {
+  if (auto Host = Digests.Find(ctx)) {
+    return fexfn_pack_EVP_DigestFinal_ex(Host, md, s);
+  }
+
+  GUEST_FN(EVP_DigestFinal_ex);
+  return Guest_EVP_DigestFinal_ex(ctx, md, s);
+}
+
+int EVP_DigestFinal(EVP_MD_CTX* ctx, unsigned char* md, unsigned int* s) {
+  if (auto Host = Digests.Find(ctx)) {
+    int Result = fexfn_pack_EVP_DigestFinal_ex(Host, md, s);
+    EVP_MD_CTX_reset(ctx);
+    return Result;
+  }
+
+  GUEST_FN(EVP_DigestFinal);
+  return Guest_EVP_DigestFinal(ctx, md, s);
+}
+
+int EVP_DigestFinalXOF(EVP_MD_CTX* ctx, unsigned char* md, size_t len) {
+  if (auto Host = Digests.Find(ctx)) {
+    return fexfn_pack_EVP_DigestFinalXOF(Host, md, len);
+  }
+
+  GUEST_FN(EVP_DigestFinalXOF);
+  return Guest_EVP_DigestFinalXOF(ctx, md, len);
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30300000L
+int EVP_DigestSqueeze(EVP_MD_CTX* ctx, unsigned char* out, size_t outlen) {
+  if (auto Host = Digests.Find(ctx)) {
+    return fexfn_pack_EVP_DigestSqueeze(Host, out, outlen);
+  }
+
+  GUEST_FN(EVP_DigestSqueeze);
+  return Guest_EVP_DigestSqueeze(ctx, out, outlen);
+}
+#endif
+
+int EVP_Digest(const void* data, size_t count, unsigned char* md, unsigned int* size, const EVP_MD* type, ENGINE* impl) {
+  if (auto HostType = impl ? nullptr : LookupHostDigest(type)) {
+    return fexfn_pack_EVP_Digest(data, count, md, size, HostType, nullptr);
+  }
+
+  GUEST_FN(EVP_Digest);
+  return Guest_EVP_Digest(data, count, md, size, type, impl);
+}
+
+int EVP_MD_CTX_set_params(EVP_MD_CTX* ctx, const OSSL_PARAM params[]) {
+  GUEST_FN(EVP_MD_CTX_set_params);
+  int Result = Guest_EVP_MD_CTX_set_params(ctx, params);
+
+  if (auto Host = Digests.Find(ctx)) {
+    Result = fexfn_pack_EVP_MD_CTX_set_params(Host, params);
+  }
+  return Result;
+}
+
+int EVP_MD_CTX_reset(EVP_MD_CTX* ctx) {
+  Digests.Detach(ctx);
+
+  GUEST_FN(EVP_MD_CTX_reset);
+  return Guest_EVP_MD_CTX_reset(ctx);
+}
+
+void EVP_MD_CTX_free(EVP_MD_CTX* ctx) {
+  Digests.Detach(ctx);
+
+  GUEST_FN(EVP_MD_CTX_free);
+  Guest_EVP_MD_CTX_free(ctx);
+}
+
+static void CopyDigest(EVP_MD_CTX* out, const EVP_MD_CTX* in) {
+  auto HostIn = Digests.Find(in);
+  auto HostOut = HostIn ? Digests.FindOrCreate(out) : nullptr;
+  if (!HostOut || !fexfn_pack_EVP_MD_CTX_copy_ex(HostOut, HostIn)) {
+    Digests.Detach(out);
+  }
+}
+
+int EVP_MD_CTX_copy_ex(EVP_MD_CTX* out, const EVP_MD_CTX* in) {
+  GUEST_FN(EVP_MD_CTX_copy_ex);
+  int Result = Guest_EVP_MD_CTX_copy_ex(out, in);
+  if (Result > 0) {
+    CopyDigest(out, in);
+  }
+  return Result;
+}
+
+int EVP_MD_CTX_copy(EVP_MD_CTX* out, const EVP_MD_CTX* in) {
+  GUEST_FN(EVP_MD_CTX_copy);
+  int Result = Guest_EVP_MD_CTX_copy(out, in);
+  if (Result > 0) {
+    CopyDigest(out, in);
+  }
+  return Result;
+}
+
+// Signing and verification set up the context through the guest libcrypto,
+// which updates it internally. Drop any host context from an earlier use.
+int EVP_DigestSignInit_ex(EVP_MD_CTX* ctx, EVP_PKEY_CTX** pctx, const char* mdname, OSSL_LIB_CTX* libctx, const char* props, EVP_PKEY* pkey,
+                          const OSSL_PARAM params[]) {
+  Digests.Detach(ctx);
+
+  GUEST_FN(EVP_DigestSignInit_ex);
+  return Guest_EVP_DigestSignInit_ex(ctx, pctx, mdname, libctx, props, pkey, params);
+}
+
+int EVP_DigestSignInit(EVP_MD_CTX* ctx, EVP_PKEY_CTX** pctx, const EVP_MD* type, ENGINE* e, EVP_PKEY* pkey) {
+  Digests.Detach(ctx);
+
+  GUEST_FN(EVP_DigestSignInit);
+  return Guest_EVP_DigestSignInit(ctx, pctx, type, e, pkey);
+}
+
+int EVP_DigestVerifyInit_ex(EVP_MD_CTX* ctx, EVP_PKEY_CTX** pctx, const char* mdname, OSSL_LIB_CTX* libctx, const char* props,
+                            EVP_PKEY* pkey, const OSSL_PARAM params[]) {
+  Digests.Detach(ctx);
+
+  GUEST_FN(EVP_DigestVerifyInit_ex);
+  return Guest_EVP_DigestVerifyInit_ex(ctx, pctx, mdname, libctx, props, pkey, params);
+}
+
+int EVP_DigestVerifyInit(EVP_MD_CTX* ctx, EVP_PKEY_CTX** pctx, const EVP_MD* type, ENGINE* e, EVP_PKEY* pkey) {
+  Digests.Detach(ctx);
+
+  GUEST_FN(EVP_DigestVerifyInit);
+  return Guest_EVP_DigestVerifyInit(ctx, pctx, type, e, pkey);
+}
+
+/* Ciphers */
+int EVP_CipherInit_ex2(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, const unsigned char* key, const unsigned char* iv, int enc,
+                       const OSSL_PARAM params[]) {
+  GUEST_FN(EVP_CipherInit_ex2);
+  int Result = Guest_EVP_CipherInit_ex2(ctx, cipher, key, iv, enc, params);
+  if (Result > 0) {
+    AttachCipher(ctx, cipher, nullptr, key, iv, enc, params);
+  }
+  return Result;
+}
+
+int EVP_CipherInit_ex(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, ENGINE* impl, const unsigned char* key, const unsigned char* iv, int enc) {
+  GUEST_FN(EVP_CipherInit_ex);
+  int Result = Guest_EVP_CipherInit_ex(ctx, cipher, impl, key, iv, enc);
+  if (Result > 0) {
+    AttachCipher(ctx, cipher, impl, key, iv, enc, nullptr);
+  }
+  return Result;
+}
+
+int EVP_CipherInit(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, const unsigned char* key, const unsigned char* iv, int enc) {
+  GUEST_FN(EVP_CipherInit);
+  int Result = Guest_EVP_CipherInit(ctx, cipher, key, iv, enc);
+  if (Result > 0) {
+    AttachCipher(ctx, cipher, nullptr, key, iv, enc, nullptr);
+  }
+  return Result;
+}
+
+int EVP_EncryptInit_ex2(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, const unsigned char* key, const unsigned char* iv, const OSSL_PARAM params[]) {
+  return EVP_CipherInit_ex2(ctx, cipher, key, iv, 1, params);
+}
+
+int EVP_EncryptInit_ex(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, ENGINE* impl, const unsigned char* key, const unsigned char* iv) {
+  return EVP_CipherInit_ex(ctx, cipher, impl, key, iv, 1);
+}
+
+int EVP_EncryptInit(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, const unsigned char* key, const unsigned char* iv) {
+  return EVP_CipherInit(ctx, cipher, key, iv, 1);
+}
+
+int EVP_DecryptInit_ex2(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, const unsigned char* key, const unsigned char* iv, const OSSL_PARAM params[]) {
+  return EVP_CipherInit_ex2(ctx, cipher, key, iv, 0, params);
+}
+
+int EVP_DecryptInit_ex(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, ENGINE* impl, const unsigned char* key, const unsigned char* iv) {
+  return EVP_CipherInit_ex(ctx, cipher, impl, key, iv, 0);
+}
+
+int EVP_DecryptInit(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* cipher, const unsigned char* key, const unsigned char* iv) {
+  return EVP_CipherInit(ctx, cipher, key, iv, 0);
+}
+
+// Envelope encryption derives the key inside the guest libcrypto, so these
+// contexts stay in the guest. Drop any host context from an earlier use.
+int EVP_SealInit(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* type, unsigned char** ek, int* ekl, unsigned char* iv, EVP_PKEY** pubk, int npubk) {
+  Ciphers.Detach(ctx);
+
+  GUEST_FN(EVP_SealInit);
+  return Guest_EVP_SealInit(ctx, type, ek, ekl, iv, pubk, npubk);
+}
+
+int EVP_OpenInit(EVP_CIPHER_CTX* ctx, const EVP_CIPHER* type, const unsigned char* ek, int ekl, const unsigned char* iv, EVP_PKEY* priv) {
+  Ciphers.Detach(ctx);
+
+  GUEST_FN(EVP_OpenInit);
+  return Guest_EVP_OpenInit(ctx, type, ek, ekl, iv, priv);
+}
+
+// The host context already knows the direction, so the Encrypt/Decrypt
+// variants all map to the Cipher functions.
+int EVP_CipherUpdate(EVP_CIPHER_CTX* ctx, unsigned char* out, int* outl, const unsigned char* in, int inl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherUpdate(Host, out, outl, in, inl);
+  }
+
+  GUEST_FN(EVP_CipherUpdate);
+  return Guest_EVP_CipherUpdate(ctx, out, outl, in, inl);
+}
+
+int EVP_EncryptUpdate(EVP_CIPHER_CTX* ctx, unsigned char* out, int* outl, const unsigned char* in, int inl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherUpdate(Host, out, outl, in, inl);
+  }
+
+  GUEST_FN(EVP_EncryptUpdate);
+  return Guest_EVP_EncryptUpdate(ctx, out, outl, in, inl);
+}
+
+int EVP_DecryptUpdate(EVP_CIPHER_CTX* ctx, unsigned char* out, int* outl, const unsigned char* in, int inl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherUpdate(Host, out, outl, in, inl);
+  }
+
+  GUEST_FN(EVP_DecryptUpdate);
+  return Guest_EVP_DecryptUpdate(ctx, out, outl, in, inl);
+}
+
+int EVP_CipherFinal_ex(EVP_CIPHER_CTX* ctx, unsigned char* outm, int* outl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherFinal_ex(Host, outm, outl);
+  }
+
+  GUEST_FN(EVP_CipherFinal_ex);
+  return Guest_EVP_CipherFinal_ex(ctx, outm, outl);
+}
+
+int EVP_CipherFinal(EVP_CIPHER_CTX* ctx, unsigned char* outm, int* outl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherFinal_ex(Host, outm, outl);
+  }
+
+  GUEST_FN(EVP_CipherFinal);
+  return Guest_EVP_CipherFinal(ctx, outm, outl);
+}
+
+int EVP_EncryptFinal_ex(EVP_CIPHER_CTX* ctx, unsigned char* out, int* outl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherFinal_ex(Host, out, outl);
+  }
+
+  GUEST_FN(EVP_EncryptFinal_ex);
+  return Guest_EVP_EncryptFinal_ex(ctx, out, outl);
+}
+
+int EVP_EncryptFinal(EVP_CIPHER_CTX* ctx, unsigned char* out, int* outl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherFinal_ex(Host, out, outl);
+  }
+
+  GUEST_FN(EVP_EncryptFinal);
+  return Guest_EVP_EncryptFinal(ctx, out, outl);
+}
+
+int EVP_DecryptFinal_ex(EVP_CIPHER_CTX* ctx, unsigned char* outm, int* outl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherFinal_ex(Host, outm, outl);
+  }
+
+  GUEST_FN(EVP_DecryptFinal_ex);
+  return Guest_EVP_DecryptFinal_ex(ctx, outm, outl);
+}
+
+int EVP_DecryptFinal(EVP_CIPHER_CTX* ctx, unsigned char* outm, int* outl) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CipherFinal_ex(Host, outm, outl);
+  }
+
+  GUEST_FN(EVP_DecryptFinal);
+  return Guest_EVP_DecryptFinal(ctx, outm, outl);
+}
+
+int EVP_Cipher(EVP_CIPHER_CTX* c, unsigned char* out, const unsigned char* in, unsigned int inl) {
+  if (auto Host = Ciphers.Find(c)) {
+    return fexfn_pack_EVP_Cipher(Host, out, in, inl);
+  }
+
+  GUEST_FN(EVP_Cipher);
+  return Guest_EVP_Cipher(c, out, in, inl);
+}
+
+int EVP_CIPHER_CTX_ctrl(EVP_CIPHER_CTX* ctx, int type, int arg, void* ptr) {
+  GUEST_FN(EVP_CIPHER_CTX_ctrl);
+
+  auto Host = Ciphers.Find(ctx);
+  if (!Host) {
+    return Guest_EVP_CIPHER_CTX_ctrl(ctx, type, arg, ptr);
+  }
+
+  int Result = fexfn_pack_EVP_CIPHER_CTX_ctrl(Host, type, arg, ptr);
+
+  // Keep the parameters the guest context reports in sync. Anything that
+  // produces output, like reading the tag, must only run on the host.
+  switch (type) {
+  case EVP_CTRL_AEAD_SET_IVLEN:
+  case EVP_CTRL_AEAD_SET_TAG:
+  case EVP_CTRL_SET_KEY_LENGTH:
+    if (Result > 0) {
+      Guest_EVP_CIPHER_CTX_ctrl(ctx, type, arg, ptr);
+    }
+    break;
+  default: break;
+  }
+
+  return Result;
+}
+
+int EVP_CIPHER_CTX_set_params(EVP_CIPHER_CTX* ctx, const OSSL_PARAM params[]) {
+  GUEST_FN(EVP_CIPHER_CTX_set_params);
+  int Result = Guest_EVP_CIPHER_CTX_set_params(ctx, params);
+
+  if (auto Host = Ciphers.Find(ctx)) {
+    Result = fexfn_pack_EVP_CIPHER_CTX_set_params(Host, params);
+  }
+  return Result;
+}
+
+int EVP_CIPHER_CTX_get_params(EVP_CIPHER_CTX* ctx, OSSL_PARAM params[]) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_get_params(Host, params);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_get_params);
+  return Guest_EVP_CIPHER_CTX_get_params(ctx, params);
+}
+
+int EVP_CIPHER_CTX_get_updated_iv(EVP_CIPHER_CTX* ctx, void* buf, size_t len) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_get_updated_iv(Host, buf, len);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_get_updated_iv);
+  return Guest_EVP_CIPHER_CTX_get_updated_iv(ctx, buf, len);
+}
+
+int EVP_CIPHER_CTX_get_original_iv(EVP_CIPHER_CTX* ctx, void* buf, size_t len) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_get_original_iv(Host, buf, len);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_get_original_iv);
+  return Guest_EVP_CIPHER_CTX_get_original_iv(ctx, buf, len);
+}
+
+// Returns pointers into the host context, which the guest can access directly.
+const unsigned char* EVP_CIPHER_CTX_iv(const EVP_CIPHER_CTX* ctx) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_iv(Host);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_iv);
+  return Guest_EVP_CIPHER_CTX_iv(ctx);
+}
+
+unsigned char* EVP_CIPHER_CTX_iv_noconst(EVP_CIPHER_CTX* ctx) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_iv_noconst(Host);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_iv_noconst);
+  return Guest_EVP_CIPHER_CTX_iv_noconst(ctx);
+}
+
+unsigned char* EVP_CIPHER_CTX_buf_noconst(EVP_CIPHER_CTX* ctx) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_buf_noconst(Host);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_buf_noconst);
+  return Guest_EVP_CIPHER_CTX_buf_noconst(ctx);
+}
+
+int EVP_CIPHER_CTX_get_num(const EVP_CIPHER_CTX* ctx) {
+  if (auto Host = Ciphers.Find(ctx)) {
+    return fexfn_pack_EVP_CIPHER_CTX_get_num(Host);
+  }
+
+  GUEST_FN(EVP_CIPHER_CTX_get_num);
+  return Guest_EVP_CIPHER_CTX_get_num(ctx);
+}
+
+int EVP_CIPHER_CTX_set_num(EVP_CIPHER_CTX* ctx, int num) {
+  GUEST_FN(EVP_CIPHER_CTX_set_num);
+  int Result = Guest_EVP_CIPHER_CTX_set_num(ctx, num);
+
+  if (auto Host = Ciphers.Find(ctx)) {
+    Result = fexfn_pack_EVP_CIPHER_CTX_set_num(Host, num);
+  }
+  return Result;
+}
+
+int EVP_CIPHER_CTX_set_padding(EVP_CIPHER_CTX* c, int pad) {
+  GUEST_FN(EVP_CIPHER_CTX_set_padding);
+  int Result = Guest_EVP_CIPHER_CTX_set_padding(c, pad);
+
+  if (auto Host = Ciphers.Find(c)) {
+    Result = fexfn_pack_EVP_CIPHER_CTX_set_padding(Host, pad);
+  }
+  return Result;
+}
+
+int EVP_CIPHER_CTX_set_key_length(EVP_CIPHER_CTX* x, int keylen) {
+  GUEST_FN(EVP_CIPHER_CTX_set_key_length);
+  int Result = Guest_EVP_CIPHER_CTX_set_key_length(x, keylen);
+
+  auto Host = Ciphers.Find(x);
+  if (Host && Result > 0) {
+    Result = fexfn_pack_EVP_CIPHER_CTX_set_key_length(Host, keylen);
+  }
+  return Result;
+}
+
+int EVP_CIPHER_CTX_reset(EVP_CIPHER_CTX* c) {
+  Ciphers.Detach(c);
+
+  GUEST_FN(EVP_CIPHER_CTX_reset);
+  return Guest_EVP_CIPHER_CTX_reset(c);
+}
+
+void EVP_CIPHER_CTX_free(EVP_CIPHER_CTX* c) {
+  Ciphers.Detach(c);
+
+  GUEST_FN(EVP_CIPHER_CTX_free);
+  Guest_EVP_CIPHER_CTX_free(c);
+}
+
+int EVP_CIPHER_CTX_copy(EVP_CIPHER_CTX* out, const EVP_CIPHER_CTX* in) {
+  GUEST_FN(EVP_CIPHER_CTX_copy);
+  int Result = Guest_EVP_CIPHER_CTX_copy(out, in);
+  if (Result > 0) {
+    auto HostIn = Ciphers.Find(in);
+    auto HostOut = HostIn ? Ciphers.FindOrCreate(out) : nullptr;
+    if (!HostOut || !fexfn_pack_EVP_CIPHER_CTX_copy(HostOut, HostIn)) {
+      Ciphers.Detach(out);
+    }
+  }
+  return Result;
+}
+}
+
+LOAD_LIB(libcrypto)
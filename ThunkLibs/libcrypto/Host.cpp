@@ -0,0 +1,14 @@
+/*
+$info$
+tags: thunklibs|crypto
+$end_info$
+*/
+
+#include <openssl/evp.h>
+
+#include "common/Host.h"
+#include <dlfcn.h>
+
+#include "thunkgen_host_libcrypto.inl"
+
+EXPORTS(libcrypto)
@@ -0,0 +1,102 @@
+#include <common/GeneratorInterface.h>
+
+// The raw IV and buffer accessors are deprecated but still in use
+#define OPENSSL_SUPPRESS_DEPRECATED
+#include <openssl/evp.h>
+
+template<auto>
+struct fex_gen_config {
+  unsigned version = 3;
+};
+
+template<typename>
+struct fex_gen_type {};
+
+// All of these are only ever handled through pointers returned by the host
+// library. The guest never looks inside of them.
+template<>
+struct fex_gen_type<evp_md_st> : fexgen::opaque_type {};
+template<>
+struct fex_gen_type<evp_md_ctx_st> : fexgen::opaque_type {};
+template<>
+struct fex_gen_type<evp_cipher_st> : fexgen::opaque_type {};
+template<>
+struct fex_gen_type<evp_cipher_ctx_st> : fexgen::opaque_type {};
+template<>
+struct fex_gen_type<engine_st> : fexgen::opaque_type {};
+template<>
+struct fex_gen_type<ossl_lib_ctx_st> : fexgen::opaque_type {};
+
+// Only holds pointers and sizes, so the layout matches on 64-bit hosts. The
+// data pointers are guest memory that the host reads and writes in place.
+template<>
+struct fex_gen_type<ossl_param_st> : fexgen::assume_compatible_data_layout {};
+
+// The guest library doesn't replace libcrypto. It interposes the guest's
+// EVP entry points and mirrors contexts to the host, see Guest.cpp.
+// Hence nothing here is exported from the guest library directly.
+template<>
+struct fex_gen_config<EVP_MD_fetch> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_MD_CTX_new> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_MD_CTX_free> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_MD_CTX_copy_ex> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_DigestInit_ex2> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_DigestUpdate> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_DigestFinal_ex> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_DigestFinalXOF> : fexgen::custom_guest_entrypoint {};
+#if OPENSSL_VERSION_NUMBER >= 0x30300000L
+template<>
+struct fex_gen_config<EVP_DigestSqueeze> : fexgen::custom_guest_entrypoint {};
+#endif
+template<>
+struct fex_gen_config<EVP_Digest> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_MD_CTX_set_params> : fexgen::custom_guest_entrypoint {};
+
+template<>
+struct fex_gen_config<EVP_CIPHER_fetch> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_new> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_free> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_copy> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_ctrl> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_set_padding> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_set_key_length> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_set_params> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_get_params> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_get_updated_iv> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_get_original_iv> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_iv> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_iv_noconst> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_buf_noconst> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_get_num> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CIPHER_CTX_set_num> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CipherInit_ex2> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CipherUpdate> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_CipherFinal_ex> : fexgen::custom_guest_entrypoint {};
+template<>
+struct fex_gen_config<EVP_Cipher> : fexgen::custom_guest_entrypoint {};
@@ -73,4 +73,9 @@ enum DivType : uint8_t {};
 enum DivType : uint32_t {};
 #endif
 int FunctionWithDivergentSignature(DivType, DivType, DivType, DivType);
+
+/// Interface used to test host->guest callbacks
+
+// Invokes the callback with the values 0 to count-1 and returns the sum of the results
+uint32_t SumCallbackResults(uint32_t (*callback)(uint32_t), uint32_t count);
 }
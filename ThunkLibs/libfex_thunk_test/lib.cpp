@@ -59,4 +59,12 @@ int FunctionWithDivergentSignature(DivType a, DivType b, DivType c, DivType d) {
   return ((uint8_t)a << 24) | ((uint8_t)b << 16) | ((uint8_t)c << 8) | (uint8_t)d;
 }
 
+uint32_t SumCallbackResults(uint32_t (*callback)(uint32_t), uint32_t count) {
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    sum += callback(i);
+  }
+  return sum;
+}
+
 } // extern "C"
@@ -53,3 +53,6 @@ struct fex_gen_config<RanCustomRepack> {};
 
 template<>
 struct fex_gen_config<FunctionWithDivergentSignature> {};
+
+template<>
+struct fex_gen_config<SumCallbackResults> {};
@@ -0,0 +1,119 @@
+/*
+$info$
+tags: thunklibs|zlib
+$end_info$
+*/
+
+#include <zlib.h>
+
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "common/Guest.h"
+
+// Conflicts with the generated gzgetc thunk
+#undef gzgetc
+
+#include "thunkgen_guest_libz.inl"
+
+// zlib would call custom allocators from host code, which can't call guest
+// functions directly. Let the host zlib use its default allocator instead.
+// The guest never frees zlib's internal state itself, so this is transparent
+// other than custom allocators not seeing these allocations.
+static z_streamp WithHostAllocator(z_streamp strm) {
+  if (strm) {
+    strm->zalloc = Z_NULL;
+    strm->zfree = Z_NULL;
+  }
+  return strm;
+}
+
+// Opens the file on the guest side so the path is resolved like any other
+// guest file access, then hands the fd to the host zlib.
+static gzFile OpenGuestFile(const char* path, const char* mode) {
+  if (!path || !mode) {
+    return nullptr;
+  }
+
+  int Flags = O_RDONLY;
+  for (const char* c = mode; *c; ++c) {
+    switch (*c) {
+    case 'r': Flags = (Flags & ~(O_WRONLY | O_CREAT | O_TRUNC | O_APPEND)) | O_RDONLY; break;
+    case 'w': Flags = (Flags & ~O_APPEND) | O_WRONLY | O_CREAT | O_TRUNC; break;
+    case 'a': Flags = (Flags & ~O_TRUNC) | O_WRONLY | O_CREAT | O_APPEND; break;
+    case 'x': Flags |= O_EXCL; break;
+    case 'e': Flags |= O_CLOEXEC; break;
+    // zlib doesn't support reading and writing at the same time
+    case '+': return nullptr;
+    default: break;
+    }
+  }
+
+  int fd = open(path, Flags | O_LARGEFILE, 0666);
+  if (fd == -1) {
+    return nullptr;
+  }
+
+  gzFile File = fexfn_pack_gzdopen(fd, mode);
+  if (!File) {
+    close(fd);
+  }
+  return File;
+}
+
+extern "C" {
+int deflateInit_(z_streamp strm, int level, const char* version, int stream_size) {
+  return fexfn_pack_deflateInit_(WithHostAllocator(strm), level, version, stream_size);
+}
+
+int deflateInit2_(z_streamp strm, int level, int method, int windowBits, int memLevel, int strategy, const char* version, int stream_size) {
+  return fexfn_pack_deflateInit2_(WithHostAllocator(strm), level, method, windowBits, memLevel, strategy, version, stream_size);
+}
+
+int inflateInit_(z_streamp strm, const char* version, int stream_size) {
+  return fexfn_pack_inflateInit_(WithHostAllocator(strm), version, stream_size);
+}
+
+int inflateInit2_(z_streamp strm, int windowBits, const char* version, int stream_size) {
+  return fexfn_pack_inflateInit2_(WithHostAllocator(strm), windowBits, version, stream_size);
+}
+
+gzFile gzopen(const char* path, const char* mode) {
+  return OpenGuestFile(path, mode);
+}
+
+gzFile gzopen64(const char* path, const char* mode) {
+  return OpenGuestFile(path, mode);
+}
+
+int gzvprintf(gzFile file, const char* format, va_list va) {
+  char* Buffer {};
+  int Len = vasprintf(&Buffer, format, va);
+  if (Len < 0) {
+    return Z_MEM_ERROR;
+  }
+
+  int Written = Len ? gzwrite(file, Buffer, Len) : 0;
+  free(Buffer);
+
+  if (Len && !Written) {
+    int Error = Z_STREAM_ERROR;
+    gzerror(file, &Error);
+    return Error;
+  }
+  return Written;
+}
+
+int gzprintf(gzFile file, const char* format, ...) {
+  va_list va;
+  va_start(va, format);
+  int Result = gzvprintf(file, format, va);
+  va_end(va);
+  return Result;
+}
+}
+
+LOAD_LIB(libz)
@@ -0,0 +1,14 @@
+/*
+$info$
+tags: thunklibs|zlib
+$end_info$
+*/
+
+#include <zlib.h>
+
+#include "common/Host.h"
+#include <dlfcn.h>
+
+#include "thunkgen_host_libz.inl"
+
+EXPORTS(libz)
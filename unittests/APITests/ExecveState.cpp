@@ -0,0 +1,162 @@
+#include "Common/ExecveState.h"
+#include "Common/FEXServerClient.h"
+
+#include <FEXCore/Config/Config.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace FEX::ExecveState;
+
+namespace {
+constexpr char RootFSPath[] = "/tmp";
+
+void InitializeConfig() {
+  static bool Initialized = false;
+  if (!Initialized) {
+    FEXCore::Config::Initialize();
+    FEXCore::Config::ReloadMetaLayer();
+    Initialized = true;
+  }
+}
+
+bool IsOpen(int FD) {
+  return fcntl(FD, F_GETFD) != -1 || errno != EBADF;
+}
+
+// Serializes a fresh state and returns its contents, the FDs it carries stay open.
+fextl::vector<char> SerializeState(Header* StateHeader) {
+  InitializeConfig();
+  SetCPUMIDRs({0x410fd4c0, 0x410fd4d0});
+
+  int RootFSFD = open(RootFSPath, O_DIRECTORY | O_PATH | O_CLOEXEC);
+  REQUIRE(RootFSFD != -1);
+  int FD = Serialize(RootFSFD, RootFSPath);
+  close(RootFSFD);
+  REQUIRE(FD != -1);
+
+  struct stat Buffer {};
+  REQUIRE(fstat(FD, &Buffer) == 0);
+  fextl::vector<char> Data(Buffer.st_size);
+  REQUIRE(pread(FD, Data.data(), Data.size(), 0) == static_cast<ssize_t>(Data.size()));
+  close(FD);
+
+  REQUIRE(Data.size() >= sizeof(Header));
+  memcpy(StateHeader, Data.data(), sizeof(Header));
+  REQUIRE(StateHeader->RootFSFD != -1);
+  return Data;
+}
+
+// Writes a possibly modified state in to a new memfd like the one Serialize creates.
+int WriteState(const fextl::vector<char>& Data, const Header& StateHeader) {
+  int FD = memfd_create("ExecveStateTest", MFD_CLOEXEC);
+  REQUIRE(FD != -1);
+  REQUIRE(write(FD, Data.data(), Data.size()) == static_cast<ssize_t>(Data.size()));
+  if (Data.size() >= sizeof(Header)) {
+    REQUIRE(pwrite(FD, &StateHeader, sizeof(Header), 0) == sizeof(Header));
+  }
+  return FD;
+}
+
+// Modifies a fresh state, then checks that it gets rejected and that the FDs it carries get closed.
+template<typename ModifyFn>
+void CheckRejected(ModifyFn&& Modify) {
+  Header StateHeader {};
+  auto Data = SerializeState(&StateHeader);
+  const int CarriedFD = StateHeader.RootFSFD;
+  Modify(Data, StateHeader);
+
+  CHECK_FALSE(LoadInherited(WriteState(Data, StateHeader)));
+  CHECK_FALSE(GetInherited().has_value());
+  CHECK_FALSE(IsOpen(CarriedFD));
+}
+} // namespace
+
+TEST_CASE("ExecveState - Round trip") {
+  Header StateHeader {};
+  auto Data = SerializeState(&StateHeader);
+
+  // Survives execve
+  CHECK((fcntl(StateHeader.RootFSFD, F_GETFD) & FD_CLOEXEC) == 0);
+  CHECK(StateHeader.ServerFD == -1);
+
+  const int CarriedFD = StateHeader.RootFSFD;
+  REQUIRE(LoadInherited(WriteState(Data, StateHeader)));
+
+  auto& Inherited = GetInherited();
+  REQUIRE(Inherited.has_value());
+  CHECK(Inherited->ServerFD == -1);
+  CHECK_FALSE(Inherited->ServerRootFSPath.has_value());
+  CHECK(Inherited->ServerEUID == geteuid());
+  CHECK(Inherited->ServerSocketName == FEXServerClient::GetServerSocketName());
+  CHECK(Inherited->RootFSPath == RootFSPath);
+  CHECK(Inherited->RootFSFD == CarriedFD);
+  REQUIRE(Inherited->CPUMIDRs.size() == 2);
+  CHECK(Inherited->CPUMIDRs[0] == 0x410fd4c0);
+  CHECK(Inherited->CPUMIDRs[1] == 0x410fd4d0);
+
+  struct stat RootFS {}, Carried {};
+  REQUIRE(stat(RootFSPath, &RootFS) == 0);
+  REQUIRE(fstat(CarriedFD, &Carried) == 0);
+  CHECK(RootFS.st_ino == Carried.st_ino);
+
+  CloseInherited();
+  CHECK_FALSE(GetInherited().has_value());
+  CHECK_FALSE(IsOpen(CarriedFD));
+}
+
+TEST_CASE("ExecveState - Version mismatch") {
+  // Different FEX build
+  CheckRejected([](fextl::vector<char>&, Header& StateHeader) { strcpy(StateHeader.FEXVersion, "FEX-not-this-build"); });
+  // Different state layout
+  CheckRejected([](fextl::vector<char>&, Header& StateHeader) { StateHeader.Version += 1; });
+}
+
+TEST_CASE("ExecveState - Truncated") {
+  CheckRejected([](fextl::vector<char>& Data, Header&) { Data.pop_back(); });
+  CheckRejected([](fextl::vector<char>& Data, Header&) { Data.push_back(0); });
+
+  // Too short to hold what the header describes
+  CheckRejected([](fextl::vector<char>&, Header& StateHeader) { StateHeader.RootFSPathLength = ~0U; });
+  CheckRejected([](fextl::vector<char>&, Header& StateHeader) { StateHeader.ServerSocketNameLength = ~0U; });
+  CheckRejected([](fextl::vector<char>&, Header& StateHeader) { StateHeader.NumCPUMIDRs = ~0U; });
+
+  // Nothing but the header
+  Header StateHeader {};
+  auto Data = SerializeState(&StateHeader);
+  const int CarriedFD = StateHeader.RootFSFD;
+  StateHeader.Size = sizeof(Header);
+  StateHeader.ServerRootFSPathLength = 0;
+  StateHeader.ServerSocketNameLength = 0;
+  StateHeader.NumCPUMIDRs = 1;
+  StateHeader.RootFSPathLength = 0;
+  Data.resize(sizeof(Header));
+  CHECK_FALSE(LoadInherited(WriteState(Data, StateHeader)));
+  CHECK_FALSE(IsOpen(CarriedFD));
+}
+
+TEST_CASE("ExecveState - Malformed") {
+  // Not a state at all, the FDs in it can't be trusted to be ours
+  Header StateHeader {};
+  auto Data = SerializeState(&StateHeader);
+  const int CarriedFD = StateHeader.RootFSFD;
+  StateHeader.Magic = 0;
+  CHECK_FALSE(LoadInherited(WriteState(Data, StateHeader)));
+  CHECK(IsOpen(CarriedFD));
+  close(CarriedFD);
+
+  // Too short for the header
+  fextl::vector<char> Short(sizeof(Header) - 1);
+  CHECK_FALSE(LoadInherited(WriteState(Short, StateHeader)));
+
+  // Trailing data the header doesn't describe
+  CheckRejected([](fextl::vector<char>& Data, Header& StateHeader) {
+    Data.resize(Data.size() + sizeof(uint32_t));
+    StateHeader.Size = Data.size();
+  });
+}
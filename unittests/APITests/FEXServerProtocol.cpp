@@ -0,0 +1,134 @@
+#include "Common/ExecveState.h"
+#include "Common/FEXServerClient.h"
+#include "ProcessPipe.h"
+#include "SquashFS.h"
+
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/fextl/fmt.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace FEXServerClient;
+
+namespace Logging {
+// Implemented by FEXServer's Main.cpp, none of these tests send log messages.
+void ClientMsgHandler(int FD, FEXServerClient::Logging::PacketMsg* const Msg, const char* MsgStr) {}
+} // namespace Logging
+
+namespace {
+// A client connected to the FEXServer request handling, without the listen socket.
+class Connection final {
+public:
+  Connection() {
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, FDs) == 0);
+  }
+
+  ~Connection() {
+    close(FDs[0]);
+    close(FDs[1]);
+  }
+
+  int Client() const {
+    return FDs[0];
+  }
+
+  int Server() const {
+    return FDs[1];
+  }
+
+  // Answers the next requests like the server's request loop does once the client socket becomes readable.
+  std::thread Serve() const {
+    return std::thread([Socket = Server()]() { ProcessPipe::HandleSocketData(Socket); });
+  }
+
+private:
+  int FDs[2] {-1, -1};
+};
+
+void InitializeConfig() {
+  static bool Initialized = false;
+  if (!Initialized) {
+    FEXCore::Config::Initialize();
+    FEXCore::Config::ReloadMetaLayer();
+    Initialized = true;
+  }
+}
+} // namespace
+
+TEST_CASE("FEXServer - Packet types older versions know") {
+  // Older clients and servers on the other end of the socket still use these values.
+  CHECK(static_cast<int>(PacketType::TYPE_KILL) == 0);
+  CHECK(static_cast<int>(PacketType::TYPE_GET_LOG_FD) == 1);
+  CHECK(static_cast<int>(PacketType::TYPE_GET_ROOTFS_PATH) == 2);
+  CHECK(static_cast<int>(PacketType::TYPE_GET_PID_FD) == 3);
+  CHECK(static_cast<int>(PacketType::TYPE_SUCCESS) == 4);
+  CHECK(static_cast<int>(PacketType::TYPE_ERROR) == 5);
+}
+
+TEST_CASE("FEXServer - Startup state round trip") {
+  InitializeConfig();
+  Connection Conn;
+
+  auto Server = Conn.Serve();
+  int StateFD = RequestStartupStateFD(Conn.Client());
+  Server.join();
+  REQUIRE(StateFD != -1);
+
+  struct stat First {};
+  REQUIRE(fstat(StateFD, &First) == 0);
+
+  REQUIRE(FEX::ExecveState::LoadInherited(StateFD));
+  auto& Inherited = FEX::ExecveState::GetInherited();
+  REQUIRE(Inherited.has_value());
+  CHECK(Inherited->ServerFD == -1);
+  REQUIRE(Inherited->ServerRootFSPath.has_value());
+  CHECK(*Inherited->ServerRootFSPath == SquashFS::GetMountFolder());
+  FEX::ExecveState::CloseInherited();
+
+  // The next client gets the same state
+  Server = Conn.Serve();
+  StateFD = RequestStartupStateFD(Conn.Client());
+  Server.join();
+  REQUIRE(StateFD != -1);
+
+  struct stat Second {};
+  REQUIRE(fstat(StateFD, &Second) == 0);
+  CHECK(First.st_ino == Second.st_ino);
+  close(StateFD);
+}
+
+TEST_CASE("FEXServer - Requests always get an answer") {
+  Connection Conn;
+
+  // No rootfs image is mounted, so there is no index to give out
+  auto Server = Conn.Serve();
+  CHECK(RequestRootFSIndexFD(Conn.Client()) == -1);
+  Server.join();
+
+  // A request type from a newer FEX version
+  FEXServerRequestPacket Req {
+    .Header {
+      .Type = static_cast<PacketType>(0x7fff),
+    },
+  };
+
+  Server = Conn.Serve();
+  REQUIRE(write(Conn.Client(), &Req, sizeof(Req.BasicRequest)) == sizeof(Req.BasicRequest));
+  Server.join();
+
+  FEXServerResultPacket Res {};
+  REQUIRE(recv(Conn.Client(), &Res, sizeof(Res), MSG_DONTWAIT) == sizeof(Res));
+  CHECK(Res.Header.Type == PacketType::TYPE_ERROR);
+}
+
+TEST_CASE("FEXServer - Older servers are never connected to") {
+  InitializeConfig();
+
+  // FEXServers from before the protocol version listened on this socket and don't know the newer requests.
+  CHECK(GetServerSocketName() != fextl::fmt::format("{}.FEXServer.Socket", ::geteuid()));
+  CHECK(GetServerSocketName() == fextl::fmt::format("{}.FEXServer.{}.Socket", ::geteuid(), PROTOCOL_VERSION));
+}
@@ -0,0 +1,238 @@
+#include "Common/RootFSIndex.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <errno.h>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace FEX::RootFSIndex;
+
+namespace {
+// Lays out a small rootfs in a temporary folder and indexes it.
+class TestRootFS final {
+public:
+  TestRootFS() {
+    char Template[] = "/tmp/FEXRootFSIndexTest-XXXXXX";
+    REQUIRE(mkdtemp(Template) != nullptr);
+    Root = Template;
+
+    Directory("usr/lib");
+    File("usr/lib/libc.so.6");
+    Directory("etc");
+    File("etc/passwd");
+    Directory("other");
+    File("other/file");
+
+    // usrmerge style relative symlink to a directory
+    Symlink("lib", "usr/lib");
+    Symlink("usr/lib/libc.so", "libc.so.6");
+    Symlink("usr/lib/up", "../../etc");
+
+    // Absolute symlinks
+    Symlink("etc/abs", "/other");
+    Symlink("etc/abs-file", "/other/file");
+
+    // Chain of relative symlinks, chain/0 -> 1 -> ... -> 40 -> ../other
+    Directory("chain");
+    for (int i = 0; i < 40; ++i) {
+      Symlink("chain/" + std::to_string(i), std::to_string(i + 1));
+    }
+    Symlink("chain/40", "../other");
+
+    // Loop
+    Symlink("loop-a", "loop-b");
+    Symlink("loop-b", "loop-a");
+
+    // Only root can read it
+    Directory("private");
+    File("private/secret");
+    chmod((Root / "private").c_str(), 0);
+  }
+
+  ~TestRootFS() {
+    chmod((Root / "private").c_str(), 0755);
+    std::filesystem::remove_all(Root);
+  }
+
+  bool Load() {
+    std::atomic<bool> Cancel {false};
+    int FD = Build(Root.string().c_str(), Cancel);
+    if (FD == -1) {
+      return false;
+    }
+    bool Result = Index.Load(FD, Root.string());
+    close(FD);
+    return Result;
+  }
+
+  LookupEntry Lookup(std::string_view Path) const {
+    return Index.Lookup(Path);
+  }
+
+  std::filesystem::path Root;
+  Reader Index;
+
+private:
+  void Directory(const char* Path) {
+    std::filesystem::create_directories(Root / Path);
+  }
+  void File(const char* Path) {
+    std::ofstream(Root / Path) << "FEX";
+  }
+  void Symlink(const std::string& Path, const std::string& Target) {
+    REQUIRE(symlink(Target.c_str(), (Root / Path).c_str()) == 0);
+  }
+};
+
+bool IsFound(const LookupEntry& Entry, EntryType Type) {
+  return Entry.Result == LookupResult::Found && Entry.Type == Type;
+}
+} // namespace
+
+TEST_CASE("RootFSIndex - Plain paths") {
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  CHECK(IsFound(RootFS.Lookup("/usr"), EntryType::Directory));
+  CHECK(IsFound(RootFS.Lookup("/usr/lib/libc.so.6"), EntryType::File));
+  CHECK(IsFound(RootFS.Lookup("//usr/./lib//libc.so.6"), EntryType::File));
+  CHECK(RootFS.Lookup("/usr/lib/libc.so.7").Result == LookupResult::NotFound);
+  CHECK(RootFS.Lookup("/missing/libc.so.6").Result == LookupResult::NotFound);
+
+  // Trailing slashes and files used as directories are left to the kernel.
+  CHECK(RootFS.Lookup("/usr/lib/").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/etc/passwd/x").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("usr").Result == LookupResult::Unknown);
+}
+
+TEST_CASE("RootFSIndex - Relative symlinks") {
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  // The final component isn't followed
+  auto Entry = RootFS.Lookup("/lib");
+  CHECK(IsFound(Entry, EntryType::Symlink));
+  CHECK(Entry.Target == "usr/lib");
+
+  Entry = RootFS.Lookup("/lib/libc.so");
+  CHECK(IsFound(Entry, EntryType::Symlink));
+  CHECK(Entry.Target == "libc.so.6");
+
+  CHECK(IsFound(RootFS.Lookup("/lib/libc.so.6"), EntryType::File));
+  CHECK(RootFS.Lookup("/lib/missing").Result == LookupResult::NotFound);
+
+  // Intermediate symlink with `..` in its target
+  CHECK(IsFound(RootFS.Lookup("/usr/lib/up/passwd"), EntryType::File));
+  CHECK(IsFound(RootFS.Lookup("/lib/up/passwd"), EntryType::File));
+}
+
+TEST_CASE("RootFSIndex - Absolute symlinks") {
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  auto Entry = RootFS.Lookup("/etc/abs-file");
+  CHECK(IsFound(Entry, EntryType::Symlink));
+  CHECK(Entry.Target == "/other/file");
+
+  // The kernel would resolve these against the host root.
+  CHECK(RootFS.Lookup("/etc/abs/file").Result == LookupResult::Unknown);
+}
+
+TEST_CASE("RootFSIndex - Dot dot") {
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  CHECK(IsFound(RootFS.Lookup("/usr/lib/../../etc/passwd"), EntryType::File));
+  CHECK(IsFound(RootFS.Lookup("/usr/../usr/lib"), EntryType::Directory));
+
+  // Walking above the rootfs or ending in `..`
+  CHECK(RootFS.Lookup("/../etc/passwd").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/usr/../../etc/passwd").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/usr/lib/..").Result == LookupResult::Unknown);
+}
+
+TEST_CASE("RootFSIndex - Symlink hop limit") {
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  // chain/1 takes exactly 40 hops to reach other
+  CHECK(IsFound(RootFS.Lookup("/chain/1/file"), EntryType::File));
+  // One more than the kernel allows
+  CHECK(RootFS.Lookup("/chain/0/file").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/loop-a/file").Result == LookupResult::Unknown);
+}
+
+TEST_CASE("RootFSIndex - Opaque directories") {
+  if (geteuid() == 0) {
+    // root can read the directory anyway
+    return;
+  }
+
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  CHECK(IsFound(RootFS.Lookup("/private"), EntryType::Directory));
+  CHECK(RootFS.Lookup("/private/secret").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/private/missing").Result == LookupResult::Unknown);
+}
+
+TEST_CASE("RootFSIndex - Matches the kernel") {
+  TestRootFS RootFS;
+  REQUIRE(RootFS.Load());
+
+  int RootFD = open(RootFS.Root.c_str(), O_DIRECTORY | O_PATH | O_CLOEXEC);
+  REQUIRE(RootFD != -1);
+
+  // Every answer the index gives must be what fstatat on the rootfs FD returns.
+  // Hits, misses, and paths through relative symlinks.
+  const char* Paths[] = {
+    "/usr",          "/usr/lib/libc.so.6", "/usr/lib/libc.so", "/usr/lib/libc.so.7", "/missing",
+    "/missing/file", "/lib",               "/lib/libc.so.6",   "/lib/libc.so",       "/lib/missing",
+    "/lib/up",       "/lib/up/passwd",     "/lib/up/missing",  "/chain/1/file",      "/chain/1/missing",
+  };
+
+  for (auto Path : Paths) {
+    INFO(Path);
+    const auto Entry = RootFS.Lookup(Path);
+    REQUIRE(Entry.Result != LookupResult::Unknown);
+
+    struct stat Buffer {};
+    const int Result = fstatat(RootFD, &Path[1], &Buffer, AT_SYMLINK_NOFOLLOW);
+    if (Entry.Result == LookupResult::NotFound) {
+      CHECK(Result == -1);
+      CHECK(errno == ENOENT);
+      continue;
+    }
+
+    REQUIRE(Result == 0);
+    switch (Entry.Type) {
+    case EntryType::Directory: CHECK(S_ISDIR(Buffer.st_mode)); break;
+    case EntryType::File: CHECK(S_ISREG(Buffer.st_mode)); break;
+    case EntryType::Symlink: CHECK(S_ISLNK(Buffer.st_mode)); break;
+    default: FAIL("Unexpected entry type"); break;
+    }
+  }
+
+  // Through an absolute symlink the kernel's answer depends on the host, so neither a hit nor a miss may be reported.
+  CHECK(RootFS.Lookup("/etc/abs/file").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/etc/abs/missing").Result == LookupResult::Unknown);
+  CHECK(RootFS.Lookup("/usr/lib/up/abs/file").Result == LookupResult::Unknown);
+
+  close(RootFD);
+}
+
+TEST_CASE("RootFSIndex - Different rootfs") {
+  TestRootFS RootFS;
+  std::atomic<bool> Cancel {false};
+  int FD = Build(RootFS.Root.string().c_str(), Cancel);
+  REQUIRE(FD != -1);
+
+  Reader Index;
+  CHECK_FALSE(Index.Load(FD, "/some/other/rootfs"));
+  CHECK(Index.Lookup("/usr").Result == LookupResult::Unknown);
+  close(FD);
+}
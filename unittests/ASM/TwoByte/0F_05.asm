@@ -0,0 +1,48 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R15": "0",
+    "R14": "0",
+    "R13": "0",
+    "R12": "0"
+  }
+}
+%endif
+
+; Syscall numbers loaded from memory aren't constant, so the JIT looks them up
+; in the passthrough table at runtime. Constant numbers are resolved while
+; compiling. Both must end up in the same syscall.
+lea rbx, [rel .data]
+sub rsp, 512
+
+; getpid, passed through to the host
+mov eax, [rbx]
+syscall
+mov r15, rax
+
+mov eax, 39
+syscall
+sub r15, rax
+
+; uname, handled by FEX
+mov eax, [rbx + 4]
+mov rdi, rsp
+syscall
+mov r14, rax
+
+mov eax, 63
+mov rdi, rsp
+syscall
+mov r13, rax
+
+; Out of range of the table
+mov eax, [rbx + 8]
+syscall
+mov r12, rax
+add r12, 38 ; -ENOSYS
+
+add rsp, 512
+hlt
+
+.data:
+dd 39, 63, 0x7fff
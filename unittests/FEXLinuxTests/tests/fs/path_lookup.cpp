@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <ftw.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// Stat-heavy workloads that package managers and compilers generate. Every
+// absolute path goes through the rootfs lookup first, so repeated lookups must
+// keep giving the same answers.
+
+TEST_CASE("Path lookup - existing files") {
+  struct stat Buffer {};
+  for (int i = 0; i < 3; ++i) {
+    REQUIRE(stat("/usr/lib", &Buffer) == 0);
+    CHECK(S_ISDIR(Buffer.st_mode));
+    CHECK(access("/usr/lib", R_OK) == 0);
+  }
+}
+
+TEST_CASE("Path lookup - header search") {
+  // A compiler looks for each header in every include directory in turn, so most lookups fail.
+  const char* IncludeDirs[] = {
+    "/usr/local/include", "/usr/include/x86_64-linux-gnu", "/usr/lib/gcc/x86_64-linux-gnu/include", "/usr/include/fex-test", "/usr/include",
+  };
+  const char* Headers[] = {"stdio.h", "stdlib.h", "string.h", "fex_does_not_exist.h", "vector", "sys/types.h"};
+
+  std::vector<std::string> Paths;
+  for (auto Header : Headers) {
+    for (auto Dir : IncludeDirs) {
+      Paths.emplace_back(std::string(Dir) + "/" + Header);
+    }
+  }
+
+  struct stat Buffer {};
+  errno = 0;
+  CHECK(stat("/usr/include/fex-test/fex_does_not_exist.h", &Buffer) == -1);
+  CHECK(errno == ENOENT);
+
+  // The second pass must see exactly what the first one did.
+  std::vector<int> First;
+  for (const auto& Path : Paths) {
+    First.push_back(stat(Path.c_str(), &Buffer) == 0 ? 0 : errno);
+  }
+
+  for (size_t i = 0; i < Paths.size(); ++i) {
+    INFO(Paths[i]);
+    CHECK((stat(Paths[i].c_str(), &Buffer) == 0 ? 0 : errno) == First[i]);
+    CHECK((access(Paths[i].c_str(), F_OK) == 0 ? 0 : errno) == First[i]);
+  }
+}
+
+static size_t EntriesVisited {};
+static size_t EntriesFailed {};
+
+static int Visit(const char*, const struct stat*, int Flag, FTW*) {
+  ++EntriesVisited;
+  if (Flag == FTW_NS) {
+    ++EntriesFailed;
+  }
+  // Stop early so the test doesn't take too long on hosts with large trees.
+  return EntriesVisited >= 20000 ? 1 : 0;
+}
+
+TEST_CASE("Path lookup - directory walk") {
+  // Behaves like `find /usr/include`, which stats every entry by absolute path.
+  struct stat Buffer {};
+  if (stat("/usr/include", &Buffer) != 0) {
+    return;
+  }
+
+  EntriesVisited = 0;
+  EntriesFailed = 0;
+  CHECK(nftw("/usr/include", Visit, 32, FTW_PHYS) != -1);
+  CHECK(EntriesVisited != 0);
+  CHECK(EntriesFailed == 0);
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+// Delivers a lot of signals to the current thread and checks that the guest
+// handler sees every one of them. Runtimes like Go and the JVM use signals for
+// preemption, so this is a hot path for them.
+
+static volatile uint64_t Delivered {};
+static volatile uint64_t LastPC {};
+
+static void Handler(int, siginfo_t*, void*) {
+  Delivered = Delivered + 1;
+}
+
+static void HandlerReadsContext(int, siginfo_t*, void* ucontext) {
+  auto Context = static_cast<ucontext_t*>(ucontext);
+#ifdef __x86_64__
+  LastPC = Context->uc_mcontext.gregs[REG_RIP];
+#else
+  LastPC = Context->uc_mcontext.gregs[REG_EIP];
+#endif
+  Delivered = Delivered + 1;
+}
+
+static void Install(int Signal, void (*Func)(int, siginfo_t*, void*)) {
+  struct sigaction Action {};
+  Action.sa_sigaction = Func;
+  Action.sa_flags = SA_SIGINFO;
+  sigemptyset(&Action.sa_mask);
+  REQUIRE(sigaction(Signal, &Action, nullptr) == 0);
+}
+
+static void SendSignals(int Signal, size_t Iterations) {
+  const pid_t PID = getpid();
+  const pid_t TID = ::syscall(SYS_gettid);
+  Delivered = 0;
+
+  for (size_t i = 0; i < Iterations; ++i) {
+    ::syscall(SYS_tgkill, PID, TID, Signal);
+  }
+
+  CHECK(Delivered == Iterations);
+}
+
+TEST_CASE("Signal delivery - tgkill") {
+  Install(SIGUSR1, Handler);
+  SendSignals(SIGUSR1, 10000);
+  signal(SIGUSR1, SIG_DFL);
+}
+
+TEST_CASE("Signal delivery - handler reads ucontext") {
+  Install(SIGURG, HandlerReadsContext);
+  SendSignals(SIGURG, 10000);
+  CHECK(LastPC != 0);
+  signal(SIGURG, SIG_DFL);
+}
+
+TEST_CASE("Signal delivery - profiling timer") {
+  // SIGPROF fires asynchronously while the thread is busy in JIT code.
+  Install(SIGPROF, Handler);
+  Delivered = 0;
+
+  itimerval Timer {};
+  Timer.it_interval.tv_usec = 100;
+  Timer.it_value.tv_usec = 100;
+  REQUIRE(setitimer(ITIMER_PROF, &Timer, nullptr) == 0);
+
+  // The timer only advances while the thread runs, and the kernel rounds it up to its tick.
+  uint64_t Spins {};
+  while (Delivered < 20) {
+    Spins = Spins + 1;
+  }
+
+  Timer = {};
+  REQUIRE(setitimer(ITIMER_PROF, &Timer, nullptr) == 0);
+  signal(SIGPROF, SIG_DFL);
+
+  CHECK(Spins != 0);
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <pthread.h>
+#include <thread>
+#include <vector>
+
+// Hammers a few pthread locks from several threads and checks that they still
+// exclude each other. Contended glibc locks spin with PAUSE before falling back
+// to futex.
+
+constexpr size_t NumThreads = 4;
+constexpr size_t Iterations = 100000;
+
+template<typename Lock, typename Unlock>
+static void Contend(Lock&& LockFunc, Unlock&& UnlockFunc) {
+  uint64_t Counter {};
+  std::vector<std::thread> Threads;
+
+  for (size_t i = 0; i < NumThreads; ++i) {
+    Threads.emplace_back([&]() {
+      for (size_t j = 0; j < Iterations; ++j) {
+        LockFunc();
+        ++Counter;
+        UnlockFunc();
+      }
+    });
+  }
+
+  for (auto& Thread : Threads) {
+    Thread.join();
+  }
+
+  CHECK(Counter == NumThreads * Iterations);
+}
+
+TEST_CASE("pthread contention - mutex") {
+  pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+  Contend([&]() { pthread_mutex_lock(&Mutex); }, [&]() { pthread_mutex_unlock(&Mutex); });
+  pthread_mutex_destroy(&Mutex);
+}
+
+TEST_CASE("pthread contention - adaptive mutex") {
+  // Adaptive mutexes spin with PAUSE for a while before sleeping in futex.
+  pthread_mutexattr_t Attr;
+  pthread_mutexattr_init(&Attr);
+  pthread_mutexattr_settype(&Attr, PTHREAD_MUTEX_ADAPTIVE_NP);
+  pthread_mutex_t Mutex;
+  pthread_mutex_init(&Mutex, &Attr);
+  pthread_mutexattr_destroy(&Attr);
+
+  Contend([&]() { pthread_mutex_lock(&Mutex); }, [&]() { pthread_mutex_unlock(&Mutex); });
+  pthread_mutex_destroy(&Mutex);
+}
+
+TEST_CASE("pthread contention - spinlock") {
+  pthread_spinlock_t Lock;
+  pthread_spin_init(&Lock, PTHREAD_PROCESS_PRIVATE);
+  Contend([&]() { pthread_spin_lock(&Lock); }, [&]() { pthread_spin_unlock(&Lock); });
+  pthread_spin_destroy(&Lock);
+}
+
+TEST_CASE("pthread contention - rwlock") {
+  pthread_rwlock_t Lock = PTHREAD_RWLOCK_INITIALIZER;
+  Contend([&]() { pthread_rwlock_wrlock(&Lock); }, [&]() { pthread_rwlock_unlock(&Lock); });
+  pthread_rwlock_destroy(&Lock);
+}
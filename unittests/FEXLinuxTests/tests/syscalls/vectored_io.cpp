@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Small scatter/gather I/O, which 32-bit guests go through the iovec conversion for.
+
+struct Fixture {
+  int fd = []() {
+    int fd = ::syscall(SYS_memfd_create, "vectored_io", 0);
+    if (fd == -1) {
+      throw std::runtime_error("Failed to create memfd\n");
+    }
+    return fd;
+  }();
+
+  ~Fixture() {
+    close(fd);
+  }
+
+  char Buffer[4][64] {};
+
+  iovec IOVec[4] = {
+    {Buffer[0], sizeof(Buffer[0])},
+    {Buffer[1], sizeof(Buffer[1])},
+    {Buffer[2], sizeof(Buffer[2])},
+    {Buffer[3], sizeof(Buffer[3])},
+  };
+};
+
+TEST_CASE_METHOD(Fixture, "Vectored I/O - preadv/pwritev") {
+  Buffer[3][63] = 'x';
+  REQUIRE(pwritev(fd, IOVec, 4, 0) == sizeof(Buffer));
+  Buffer[3][63] = '\0';
+  REQUIRE(preadv(fd, IOVec, 4, 0) == sizeof(Buffer));
+  CHECK(Buffer[3][63] == 'x');
+}
+
+TEST_CASE_METHOD(Fixture, "Vectored I/O - readv/writev") {
+  Buffer[0][0] = 'a';
+  Buffer[3][63] = 'z';
+  REQUIRE(writev(fd, IOVec, 4) == sizeof(Buffer));
+  CHECK(lseek(fd, 0, SEEK_CUR) == sizeof(Buffer));
+
+  Buffer[0][0] = '\0';
+  Buffer[3][63] = '\0';
+  REQUIRE(lseek(fd, 0, SEEK_SET) == 0);
+  REQUIRE(readv(fd, IOVec, 4) == sizeof(Buffer));
+  CHECK(Buffer[0][0] == 'a');
+  CHECK(Buffer[3][63] == 'z');
+}
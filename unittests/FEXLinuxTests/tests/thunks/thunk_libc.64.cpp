@@ -0,0 +1,67 @@
+#include <string.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Runs both emulated and with the libc thunks preloaded. Each test checks the
+// results of one function, both configurations must agree.
+
+// Calls go through volatile function pointers so the compiler can't inline
+// or constant-fold them.
+template<typename Fn>
+static Fn* Opaque(Fn* Func) {
+  Fn* volatile Ptr = Func;
+  return Ptr;
+}
+
+TEST_CASE("libc - memcpy") {
+  auto Fn = Opaque(&memcpy);
+  std::vector<uint8_t> Src(64 * 1024), Dst(64 * 1024);
+  for (size_t i = 0; i < Src.size(); ++i) {
+    Src[i] = i * 7;
+  }
+
+  Fn(Dst.data(), Src.data(), Src.size());
+  CHECK(Dst == Src);
+}
+
+TEST_CASE("libc - memmove") {
+  auto Fn = Opaque(&memmove);
+  std::vector<uint8_t> Buffer(64 * 1024 + 1);
+  for (size_t i = 0; i < Buffer.size(); ++i) {
+    Buffer[i] = i;
+  }
+
+  Fn(Buffer.data() + 1, Buffer.data(), Buffer.size() - 1);
+  CHECK(Buffer[1] == 0);
+  CHECK(Buffer[256] == 255);
+}
+
+TEST_CASE("libc - memset") {
+  auto Fn = Opaque(&memset);
+  std::vector<uint8_t> Buffer(64 * 1024);
+
+  Fn(Buffer.data(), 0x5a, Buffer.size());
+  CHECK(Buffer.front() == 0x5a);
+  CHECK(Buffer.back() == 0x5a);
+}
+
+TEST_CASE("libc - memchr") {
+  auto Fn = Opaque(static_cast<const void* (*)(const void*, int, size_t)>(&memchr));
+  std::vector<uint8_t> Buffer(64 * 1024);
+  Buffer.back() = 1;
+
+  CHECK(Fn(Buffer.data(), 1, Buffer.size()) == &Buffer.back());
+  CHECK(Fn(Buffer.data(), 2, Buffer.size()) == nullptr);
+}
+
+TEST_CASE("libc - strlen") {
+  auto Fn = Opaque(&strlen);
+  std::vector<char> Buffer(64 * 1024, 'a');
+  Buffer.back() = '\0';
+
+  CHECK(Fn(Buffer.data()) == Buffer.size() - 1);
+  CHECK(Fn(&Buffer[Buffer.size() - 64]) == 63);
+}
@@ -0,0 +1,232 @@
+#include <openssl/evp.h>
+#include <openssl/opensslv.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Runs both emulated and with the libcrypto thunks preloaded. The results are
+// checked against published test vectors, so both configurations must produce
+// the same output. State that only the host context tracks, like the running
+// IV, is read back in between updates.
+
+using MDContext = std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)>;
+using CipherContext = std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)>;
+
+static std::vector<uint8_t> FromHex(std::string_view Hex) {
+  std::vector<uint8_t> Data;
+  for (size_t i = 0; i + 1 < Hex.size(); i += 2) {
+    Data.push_back(std::stoul(std::string {Hex.substr(i, 2)}, nullptr, 16));
+  }
+  return Data;
+}
+
+static std::string ToHex(const uint8_t* Data, size_t Size) {
+  std::string Hex;
+  for (size_t i = 0; i < Size; ++i) {
+    char Tmp[3];
+    snprintf(Tmp, sizeof(Tmp), "%02x", Data[i]);
+    Hex += Tmp;
+  }
+  return Hex;
+}
+
+static std::string FinalHex(EVP_MD_CTX* Ctx) {
+  uint8_t MD[EVP_MAX_MD_SIZE];
+  unsigned int Size {};
+  REQUIRE(EVP_DigestFinal_ex(Ctx, MD, &Size) == 1);
+  return ToHex(MD, Size);
+}
+
+TEST_CASE("libcrypto - SHA-256 streaming") {
+  MDContext Ctx {EVP_MD_CTX_new(), EVP_MD_CTX_free};
+  REQUIRE(EVP_DigestInit_ex(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "a", 1) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "bc", 2) == 1);
+  CHECK(FinalHex(Ctx.get()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+  // One million times 'a', fed in chunks that don't line up with the block size.
+  // Halfway through the context is copied, and both copies must finish the same.
+  const std::vector<uint8_t> Chunk(997, 'a');
+  constexpr size_t Total = 1000000;
+  MDContext Copy {EVP_MD_CTX_new(), EVP_MD_CTX_free};
+  REQUIRE(EVP_DigestInit_ex(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  for (size_t Offset = 0; Offset < Total; Offset += Chunk.size()) {
+    if (Offset >= Total / 2 && Offset < Total / 2 + Chunk.size()) {
+      REQUIRE(EVP_MD_CTX_copy_ex(Copy.get(), Ctx.get()) == 1);
+      REQUIRE(EVP_DigestUpdate(Copy.get(), Chunk.data(), std::min(Chunk.size(), Total - Offset)) == 1);
+    } else if (Offset > Total / 2) {
+      REQUIRE(EVP_DigestUpdate(Copy.get(), Chunk.data(), std::min(Chunk.size(), Total - Offset)) == 1);
+    }
+    REQUIRE(EVP_DigestUpdate(Ctx.get(), Chunk.data(), std::min(Chunk.size(), Total - Offset)) == 1);
+  }
+  CHECK(FinalHex(Ctx.get()) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+  CHECK(FinalHex(Copy.get()) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30300000L
+TEST_CASE("libcrypto - SHAKE128 squeeze") {
+  MDContext Ctx {EVP_MD_CTX_new(), EVP_MD_CTX_free};
+  REQUIRE(EVP_DigestInit_ex(Ctx.get(), EVP_shake128(), nullptr) == 1);
+
+  uint8_t Out[32];
+  REQUIRE(EVP_DigestSqueeze(Ctx.get(), Out, 5) == 1);
+  REQUIRE(EVP_DigestSqueeze(Ctx.get(), Out + 5, sizeof(Out) - 5) == 1);
+  CHECK(ToHex(Out, sizeof(Out)) == "7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26");
+}
+#endif
+
+// Resolves a function of the guest libcrypto itself, bypassing the thunk
+// library. Stands in for calls libcrypto makes internally.
+template<auto Function>
+static auto Unthunked(const char* Name) {
+  Dl_info Info {};
+  REQUIRE(dladdr(reinterpret_cast<void*>(&EVP_MD_CTX_new), &Info) != 0);
+  void* Handle = dlopen(Info.dli_fname, RTLD_NOW | RTLD_NOLOAD);
+  REQUIRE(Handle != nullptr);
+  auto Result = reinterpret_cast<decltype(Function)>(dlsym(Handle, Name));
+  REQUIRE(Result != nullptr);
+  dlclose(Handle);
+  return Result;
+}
+
+TEST_CASE("libcrypto - Digest contexts reset or reused by libcrypto") {
+  auto Reset = Unthunked<&EVP_MD_CTX_reset>("EVP_MD_CTX_reset");
+  auto Free = Unthunked<&EVP_MD_CTX_free>("EVP_MD_CTX_free");
+  auto Init = Unthunked<&EVP_DigestInit_ex>("EVP_DigestInit_ex");
+
+  MDContext Ctx {EVP_MD_CTX_new(), EVP_MD_CTX_free};
+  REQUIRE(EVP_DigestInit_ex(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "stale", 5) == 1);
+  REQUIRE(Reset(Ctx.get()) == 1);
+  REQUIRE(Init(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "abc", 3) == 1);
+  CHECK(FinalHex(Ctx.get()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+  // The next context likely reuses the memory of the freed one
+  REQUIRE(EVP_DigestInit_ex(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "stale", 5) == 1);
+  Free(Ctx.release());
+  Ctx.reset(EVP_MD_CTX_new());
+  REQUIRE(Init(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "abc", 3) == 1);
+  CHECK(FinalHex(Ctx.get()) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_CASE("libcrypto - Signing with a previously used digest context") {
+  // RFC 4231 test case 2
+  std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)> Key {
+    EVP_PKEY_new_raw_private_key(EVP_PKEY_HMAC, nullptr, reinterpret_cast<const uint8_t*>("Jefe"), 4), EVP_PKEY_free};
+  REQUIRE(Key);
+
+  MDContext Ctx {EVP_MD_CTX_new(), EVP_MD_CTX_free};
+  REQUIRE(EVP_DigestInit_ex(Ctx.get(), EVP_sha256(), nullptr) == 1);
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), "stale", 5) == 1);
+
+  REQUIRE(EVP_DigestSignInit(Ctx.get(), nullptr, EVP_sha256(), nullptr, Key.get()) == 1);
+  const std::string_view Data = "what do ya want for nothing?";
+  REQUIRE(EVP_DigestUpdate(Ctx.get(), Data.data(), Data.size()) == 1);
+  uint8_t MAC[EVP_MAX_MD_SIZE];
+  size_t Size = sizeof(MAC);
+  REQUIRE(EVP_DigestSignFinal(Ctx.get(), MAC, &Size) == 1);
+  CHECK(ToHex(MAC, Size) == "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+}
+
+// NIST SP 800-38A test vectors
+static const auto Key = FromHex("2b7e151628aed2a6abf7158809cf4f3c");
+static const auto Plaintext = FromHex("6bc1bee22e409f96e93d7e117393172a"
+                                      "ae2d8a571e03ac9c9eb76fac45af8e51"
+                                      "30c81c46a35ce411e5fbc1191a0a52ef"
+                                      "f69f2445df4f9b17ad2b417be66c3710");
+
+TEST_CASE("libcrypto - AES-128-CBC IV round trip") {
+  const auto IV = FromHex("000102030405060708090a0b0c0d0e0f");
+  const char* Expected[] = {
+    "7649abac8119b246cee98e9b12e9197d",
+    "5086cb9b507219ee95db113a917678b2",
+    "73bed6b8e3c1743b7116e69e22229516",
+    "3ff1caa1681fac09120eca307586e1a7",
+  };
+
+  CipherContext Ctx {EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free};
+  REQUIRE(EVP_EncryptInit_ex(Ctx.get(), EVP_aes_128_cbc(), nullptr, Key.data(), IV.data()) == 1);
+  REQUIRE(EVP_CIPHER_CTX_set_padding(Ctx.get(), 0) == 1);
+
+  std::vector<uint8_t> Ciphertext(Plaintext.size());
+  for (size_t Block = 0; Block < 4; ++Block) {
+    int Size {};
+    REQUIRE(EVP_EncryptUpdate(Ctx.get(), Ciphertext.data() + Block * 16, &Size, Plaintext.data() + Block * 16, 16) == 1);
+    REQUIRE(Size == 16);
+    CHECK(ToHex(Ciphertext.data() + Block * 16, 16) == Expected[Block]);
+
+    // In CBC mode the running IV is the last ciphertext block
+    uint8_t UpdatedIV[16];
+    REQUIRE(EVP_CIPHER_CTX_get_updated_iv(Ctx.get(), UpdatedIV, sizeof(UpdatedIV)) == 1);
+    CHECK(ToHex(UpdatedIV, sizeof(UpdatedIV)) == Expected[Block]);
+
+    uint8_t OriginalIV[16];
+    REQUIRE(EVP_CIPHER_CTX_get_original_iv(Ctx.get(), OriginalIV, sizeof(OriginalIV)) == 1);
+    CHECK(ToHex(OriginalIV, sizeof(OriginalIV)) == ToHex(IV.data(), IV.size()));
+  }
+  int Size {};
+  REQUIRE(EVP_EncryptFinal_ex(Ctx.get(), nullptr, &Size) == 1);
+  CHECK(Size == 0);
+
+  // Continue decrypting from the IV read back above
+  uint8_t UpdatedIV[16];
+  REQUIRE(EVP_DecryptInit_ex(Ctx.get(), EVP_aes_128_cbc(), nullptr, Key.data(), IV.data()) == 1);
+  REQUIRE(EVP_CIPHER_CTX_set_padding(Ctx.get(), 0) == 1);
+  std::vector<uint8_t> Decrypted(Plaintext.size());
+  REQUIRE(EVP_DecryptUpdate(Ctx.get(), Decrypted.data(), &Size, Ciphertext.data(), 32) == 1);
+  REQUIRE(Size == 32);
+  REQUIRE(EVP_CIPHER_CTX_get_updated_iv(Ctx.get(), UpdatedIV, sizeof(UpdatedIV)) == 1);
+
+  CipherContext Second {EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free};
+  REQUIRE(EVP_DecryptInit_ex(Second.get(), EVP_aes_128_cbc(), nullptr, Key.data(), UpdatedIV) == 1);
+  REQUIRE(EVP_CIPHER_CTX_set_padding(Second.get(), 0) == 1);
+  REQUIRE(EVP_DecryptUpdate(Second.get(), Decrypted.data() + 32, &Size, Ciphertext.data() + 32, 32) == 1);
+  REQUIRE(Size == 32);
+  CHECK(Decrypted == Plaintext);
+}
+
+TEST_CASE("libcrypto - Cipher context reset by libcrypto") {
+  auto Reset = Unthunked<&EVP_CIPHER_CTX_reset>("EVP_CIPHER_CTX_reset");
+  auto Init = Unthunked<&EVP_CipherInit_ex2>("EVP_CipherInit_ex2");
+  const auto IV = FromHex("000102030405060708090a0b0c0d0e0f");
+
+  CipherContext Ctx {EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free};
+  std::vector<uint8_t> Ciphertext(16);
+  int Size {};
+  REQUIRE(EVP_EncryptInit_ex(Ctx.get(), EVP_aes_128_ctr(), nullptr, Key.data(), IV.data()) == 1);
+  REQUIRE(EVP_EncryptUpdate(Ctx.get(), Ciphertext.data(), &Size, Plaintext.data(), 5) == 1);
+
+  REQUIRE(Reset(Ctx.get()) == 1);
+  REQUIRE(Init(Ctx.get(), EVP_aes_128_cbc(), Key.data(), IV.data(), 1, nullptr) == 1);
+  REQUIRE(EVP_EncryptUpdate(Ctx.get(), Ciphertext.data(), &Size, Plaintext.data(), 16) == 1);
+  REQUIRE(Size == 16);
+  CHECK(ToHex(Ciphertext.data(), 16) == "7649abac8119b246cee98e9b12e9197d");
+}
+
+TEST_CASE("libcrypto - AES-128-CTR stream position") {
+  const auto Counter = FromHex("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+
+  CipherContext Ctx {EVP_CIPHER_CTX_new(), EVP_CIPHER_CTX_free};
+  REQUIRE(EVP_EncryptInit_ex(Ctx.get(), EVP_aes_128_ctr(), nullptr, Key.data(), Counter.data()) == 1);
+
+  std::vector<uint8_t> Ciphertext(32);
+  int Size {};
+  REQUIRE(EVP_EncryptUpdate(Ctx.get(), Ciphertext.data(), &Size, Plaintext.data(), 5) == 1);
+  CHECK(EVP_CIPHER_CTX_get_num(Ctx.get()) == 5);
+  REQUIRE(EVP_EncryptUpdate(Ctx.get(), Ciphertext.data() + 5, &Size, Plaintext.data() + 5, 27) == 1);
+  CHECK(EVP_CIPHER_CTX_get_num(Ctx.get()) == 0);
+  CHECK(ToHex(Ciphertext.data(), 32) == "874d6191b620e3261bef6864990db6ce"
+                                        "9806f66b7970fdff8617187bb9fffdff");
+}
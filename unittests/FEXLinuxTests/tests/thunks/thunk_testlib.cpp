@@ -36,6 +36,8 @@ struct Fixture {
   GET_SYMBOL(RanCustomRepack);
 
   GET_SYMBOL(FunctionWithDivergentSignature);
+
+  GET_SYMBOL(SumCallbackResults);
 };
 
 TEST_CASE_METHOD(Fixture, "Trivial") {
@@ -89,3 +91,16 @@ TEST_CASE_METHOD(Fixture, "Assisted struct repacking") {
 TEST_CASE_METHOD(Fixture, "Function signature with differing parameter sizes") {
   CHECK(FunctionWithDivergentSignature(DivType {1}, DivType {2}, DivType {3}, DivType {4}) == 0x01020304);
 }
+
+static uint32_t TripleValue(uint32_t value) {
+  return 3 * value;
+}
+
+TEST_CASE_METHOD(Fixture, "Host to guest callbacks") {
+  CHECK(SumCallbackResults(TripleValue, 0) == 0);
+  CHECK(SumCallbackResults(TripleValue, 4) == 18);
+
+  // Repeated calls to the same callback take the JIT's cached entry after the first one
+  constexpr uint32_t Iterations = 100000;
+  CHECK(SumCallbackResults(TripleValue, Iterations) == static_cast<uint32_t>(3 * (uint64_t {Iterations} * (Iterations - 1) / 2)));
+}
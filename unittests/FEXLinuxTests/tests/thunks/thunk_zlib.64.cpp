@@ -0,0 +1,98 @@
+#include <zlib.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+#include <unistd.h>
+
+// Runs both emulated and with the zlib thunks enabled. Data must survive a
+// round trip in both configurations.
+
+static std::vector<uint8_t> MakeInput(size_t Size) {
+  // Somewhat compressible data: repeated words with pseudo-random noise.
+  std::vector<uint8_t> Data(Size);
+  uint32_t State = 0x12345678;
+  static const char Words[] = "the quick brown fox jumps over the lazy dog ";
+  for (size_t i = 0; i < Size; ++i) {
+    State = State * 1103515245 + 12345;
+    Data[i] = (State >> 28) == 0 ? static_cast<uint8_t>(State >> 16) : Words[i % (sizeof(Words) - 1)];
+  }
+  return Data;
+}
+
+TEST_CASE("zlib - compress round trip") {
+  const auto Input = MakeInput(1024 * 1024);
+
+  uLongf CompressedSize = compressBound(Input.size());
+  std::vector<uint8_t> Compressed(CompressedSize);
+  REQUIRE(compress2(Compressed.data(), &CompressedSize, Input.data(), Input.size(), Z_DEFAULT_COMPRESSION) == Z_OK);
+  CHECK(CompressedSize < Input.size());
+
+  uLongf OutputSize = Input.size();
+  std::vector<uint8_t> Output(OutputSize);
+  REQUIRE(uncompress(Output.data(), &OutputSize, Compressed.data(), CompressedSize) == Z_OK);
+  REQUIRE(OutputSize == Input.size());
+  CHECK(Output == Input);
+
+  CHECK(crc32(0, Input.data(), Input.size()) == crc32(0, Output.data(), Output.size()));
+  CHECK(adler32(1, Input.data(), Input.size()) == adler32(1, Output.data(), Output.size()));
+}
+
+TEST_CASE("zlib - stream round trip") {
+  const auto Input = MakeInput(256 * 1024);
+
+  z_stream Deflate {};
+  REQUIRE(deflateInit2(&Deflate, 6, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+  std::vector<uint8_t> Compressed(deflateBound(&Deflate, Input.size()));
+
+  // Feed the input in small chunks to exercise state kept across calls.
+  Deflate.next_out = Compressed.data();
+  Deflate.avail_out = Compressed.size();
+  for (size_t Offset = 0; Offset < Input.size(); Offset += 4096) {
+    Deflate.next_in = const_cast<uint8_t*>(Input.data() + Offset);
+    Deflate.avail_in = 4096;
+    REQUIRE(deflate(&Deflate, Z_NO_FLUSH) == Z_OK);
+  }
+  REQUIRE(deflate(&Deflate, Z_FINISH) == Z_STREAM_END);
+  Compressed.resize(Deflate.total_out);
+  REQUIRE(deflateEnd(&Deflate) == Z_OK);
+
+  z_stream Inflate {};
+  REQUIRE(inflateInit2(&Inflate, 15 + 16) == Z_OK);
+  std::vector<uint8_t> Output(Input.size());
+  Inflate.next_in = Compressed.data();
+  Inflate.avail_in = Compressed.size();
+  Inflate.next_out = Output.data();
+  Inflate.avail_out = Output.size();
+  REQUIRE(inflate(&Inflate, Z_FINISH) == Z_STREAM_END);
+  CHECK(Inflate.total_out == Input.size());
+  REQUIRE(inflateEnd(&Inflate) == Z_OK);
+
+  CHECK(Output == Input);
+}
+
+TEST_CASE("zlib - gzip file") {
+  char Path[] = "/tmp/fex_thunk_zlib_XXXXXX";
+  int fd = mkstemp(Path);
+  REQUIRE(fd != -1);
+  close(fd);
+
+  gzFile Out = gzopen(Path, "wb");
+  REQUIRE(Out);
+  CHECK(gzprintf(Out, "%s %d\n", "line", 1) == 7);
+  CHECK(gzputs(Out, "line 2\n") == 7);
+  REQUIRE(gzclose(Out) == Z_OK);
+
+  gzFile In = gzopen(Path, "rb");
+  REQUIRE(In);
+  char Buffer[64] {};
+  CHECK(gzread(In, Buffer, sizeof(Buffer)) == 14);
+  CHECK(std::string_view {Buffer} == "line 1\nline 2\n");
+  REQUIRE(gzclose(In) == Z_OK);
+
+  unlink(Path);
+}
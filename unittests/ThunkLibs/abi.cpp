@@ -253,6 +253,21 @@ TEST_CASE_METHOD(Fixture, "DataLayout") {
     CHECK(action->GetTypeCompatibility("struct A") == compat_full64_repackable32);
   }
 
+  SECTION("Array of platform-dependent size (size_t)") {
+    auto action = compute_data_layout("#include <thunks_common.h>\n"
+                                      "#include <cstdlib>\n",
+                                      "struct A { size_t a[64]; };\n"
+                                      "template<> struct fex_gen_type<A> {};\n",
+                                      guest_abi);
+
+    INFO(FormatDataLayout(action->host_layout));
+
+    REQUIRE(action->guest_layout->contains("A"));
+    // Array elements are mapped to fixed-size integers like non-array members
+    CHECK(action->guest_layout->at("A").get_if_struct()->members[0].type_name == (guest_abi == GuestABI::X86_32 ? "uint32_t" : "uint64_t"));
+    CHECK(action->GetTypeCompatibility("struct A") == compat_full64_repackable32);
+  }
+
   SECTION("int64_t with explicit alignment specification") {
     auto action = compute_data_layout("#include <thunks_common.h>\n"
                                       "#include <cstdint>\n",
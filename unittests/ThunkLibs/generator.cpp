@@ -609,6 +609,46 @@ TEST_CASE_METHOD(Fixture, "LayoutWrappers") {
     CHECK_THAT(output, host_layout_is_trivial);
   }
 
+  // Array members use guest_layout for their elements. Arrays with consistent
+  // element layout (a) are copied in bulk, others (b) are repacked per element
+  SECTION("Type with array members") {
+    const char* struct_def = "#include <cstdint>\n"
+                             "struct B { int64_t a; };\n"
+                             "struct A { int64_t a[4]; B b[2]; };\n";
+    const std::string code = "template<typename> struct fex_gen_type {};\n"
+                             "template<> struct fex_gen_type<A> {};\n"
+                             "template<> struct fex_gen_type<B> {};\n";
+    const auto output = run_thunkgen_host(struct_def, code, guest_abi);
+    if (guest_abi == GuestABI::X86_32) {
+      CHECK_THAT(output, matches(classTemplateSpecializationDecl(
+                           hasName("guest_layout"), hasAnyTemplateArgument(refersToType(asString("struct A"))),
+                           has(fieldDecl(hasName("data"), hasType(hasCanonicalType(hasDeclaration(decl(
+                                                            has(fieldDecl(hasName("a"), hasType(asString("guest_layout<int64_t>[4]")))),
+                                                            has(fieldDecl(hasName("b"), hasType(asString("guest_layout<" CLANG_STRUCT_PREFIX "B>[2]")))))))))))));
+      CHECK_THAT(output, matches(callExpr(callee(functionDecl(hasName("memcpy"))))));
+    }
+    CHECK_THAT(output, guest_converter_defined);
+    CHECK_THAT(output, host_layout_is_trivial);
+  }
+
+  // long double has the same size on 64-bit guests and hosts but a different
+  // representation, so its arrays must not be copied in bulk
+  SECTION("Type with long double array members") {
+    if (guest_abi == GuestABI::X86_64) {
+      const char* struct_def = "#include <cstdint>\n"
+                               "#ifdef HOST\n"
+                               "struct A { int32_t b; int32_t c; long double a[2]; };\n"
+                               "#else\n"
+                               "struct A { int32_t c; int32_t b; long double a[2]; };\n"
+                               "#endif\n";
+      const auto output = run_thunkgen_host(struct_def, code, guest_abi);
+      CHECK_THAT(output, matches(cxxConstructorDecl(ofClass(classTemplateSpecializationDecl(
+                                                      hasName("host_layout"), hasAnyTemplateArgument(refersToType(asString("struct A"))))),
+                                                    hasDescendant(forStmt()))));
+      CHECK_THAT(output, guest_converter_defined);
+    }
+  }
+
   // For incompatible types, use of guest_layout nor host_layout should be prohibited
   SECTION("Incompatible type, unannotated") {
     const char* struct_def = "#ifdef HOST\n"